@@ -0,0 +1,569 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/VerifyGlobs.cmake"
+  "CMakeFiles/cmake.verify_globs"
+  "/root/repo/benchmarks/cmake/CCCLBenchmarkRegistry.cmake"
+  "/root/repo/cmake/CCCLClangdCompileInfo.cmake"
+  "/root/repo/cmake/CCCLHideThirdPartyOptions.cmake"
+  "/root/repo/cmake/CCCLInstallRules.cmake"
+  "/root/repo/cmake/CCCLUtilities.cmake"
+  "/root/repo/cub/CMakeLists.txt"
+  "/root/repo/cub/cmake/CubAddSubdir.cmake"
+  "/root/repo/cub/cmake/CubInstallRules.cmake"
+  "/root/repo/cub/cub/cmake/cub-config-version.cmake"
+  "/root/repo/cub/cub/cmake/cub-config.cmake"
+  "/root/repo/cub/cub/cmake/cub-header-search.cmake"
+  "/root/repo/cub/cub/cmake/cub-header-search.cmake.in"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/libcudacxx/CMakeLists.txt"
+  "/root/repo/libcudacxx/cmake/libcudacxxAddSubdir.cmake"
+  "/root/repo/libcudacxx/lib/cmake/libcudacxx/libcudacxx-config-version.cmake"
+  "/root/repo/libcudacxx/lib/cmake/libcudacxx/libcudacxx-config.cmake"
+  "/root/repo/libcudacxx/lib/cmake/libcudacxx/libcudacxx-header-search.cmake"
+  "/root/repo/thrust/CMakeLists.txt"
+  "/root/repo/thrust/benchmarks/CMakeLists.txt"
+  "/root/repo/thrust/cmake/AppendOptionIfAvailable.cmake"
+  "/root/repo/thrust/cmake/ThrustBuildCompilerTargets.cmake"
+  "/root/repo/thrust/cmake/ThrustBuildTargetList.cmake"
+  "/root/repo/thrust/cmake/ThrustFindThrust.cmake"
+  "/root/repo/thrust/cmake/ThrustInstallRules.cmake"
+  "/root/repo/thrust/cmake/ThrustMultiConfig.cmake"
+  "/root/repo/thrust/cmake/ThrustUtilities.cmake"
+  "/root/repo/thrust/cmake/wrap_source_file.cpp.in"
+  "/root/repo/thrust/thrust/cmake/thrust-config-version.cmake"
+  "/root/repo/thrust/thrust/cmake/thrust-config.cmake"
+  "/root/repo/thrust/thrust/cmake/thrust-header-search.cmake"
+  "/root/repo/thrust/thrust/cmake/thrust-header-search.cmake.in"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindCUDAToolkit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libcudacxx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "cub/cub/cmake/cub-header-search.cmake"
+  "cub/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thrust/thrust/cmake/thrust-header-search.cmake"
+  "thrust/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/cub/benchmarks/nvbench_helper/nvbench_helper/nvbench_helper.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/cub/benchmarks/nvbench_helper/nvbench_helper/nvbench_helper.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/cub/benchmarks/nvbench_helper/nvbench_helper/nvbench_helper.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/cub/benchmarks/nvbench_helper/nvbench_helper/nvbench_helper.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/cub/benchmarks/nvbench_helper/nvbench_helper/nvbench_helper.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/custom.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/custom.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/custom.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/custom.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/custom.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/in_place.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/in_place.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/in_place.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/in_place.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/adjacent_difference/in_place.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/copy/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/copy/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/copy/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/copy/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/copy/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/copy/if.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/copy/if.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/copy/if.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/copy/if.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/copy/if.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/equal/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/equal/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/equal/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/equal/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/equal/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/fill/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/fill/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/fill/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/fill/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/fill/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/for_each/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/for_each/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/for_each/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/for_each/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/for_each/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/inner_product/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/inner_product/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/inner_product/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/inner_product/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/inner_product/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/merge/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/merge/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/merge/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/merge/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/merge/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/mr/oversized.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/mr/oversized.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/mr/oversized.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/mr/oversized.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/mr/oversized.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/partition/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/partition/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/partition/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/partition/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/partition/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/reduce/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/reduce/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/reduce/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/reduce/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/reduce/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/reduce/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/reduce/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/reduce/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/reduce/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/reduce/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/max.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/max.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/max.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/max.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/max.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/sum.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/sum.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/sum.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/sum.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/exclusive/sum.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/max.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/max.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/max.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/max.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/max.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/sum.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/sum.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/sum.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/sum.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/sum.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/union.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/union.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/union.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/union.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/union.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/union_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/union_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/union_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/union_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/union_by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/shuffle/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/shuffle/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/shuffle/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/shuffle/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/shuffle/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/sort/keys.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/keys.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/sort/keys.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/keys.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/sort/keys.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/sort/keys_custom.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/keys_custom.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/sort/keys_custom.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/keys_custom.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/sort/keys_custom.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs_custom.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs_custom.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs_custom.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs_custom.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs_custom.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/sort/radix.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/radix.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/sort/radix.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/radix.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/sort/radix.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/tabulate/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/tabulate/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/tabulate/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/tabulate/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/tabulate/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/transform/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/transform/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/transform/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/transform/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/transform/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/transform_reduce/sum.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/transform_reduce/sum.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/transform_reduce/sum.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/transform_reduce/sum.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/transform_reduce/sum.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/unique/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/unique/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/unique/basic.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/unique/basic.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/unique/basic.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/unique/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/unique/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/unique/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/unique/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/unique/by_key.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/base.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/base.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/base.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/base.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/base.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/lower_bound.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/lower_bound.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/lower_bound.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/lower_bound.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/lower_bound.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/upper_bound.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/upper_bound.cu.cpp"
+  "thrust/benchmarks/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/upper_bound.cu.cpp"
+  "thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/upper_bound.cu.cpp"
+  "thrust/benchmarks/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/upper_bound.cu.cpp"
+  "thrust/benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "thrust/CMakeFiles/thrust.all.dir/DependInfo.cmake"
+  "thrust/CMakeFiles/thrust.cpp.cpp.cpp17.all.dir/DependInfo.cmake"
+  "thrust/CMakeFiles/thrust.cpp.omp.cpp17.all.dir/DependInfo.cmake"
+  "thrust/CMakeFiles/thrust.cpp.tbb.cpp17.all.dir/DependInfo.cmake"
+  "thrust/CMakeFiles/thrust.omp.omp.cpp17.all.dir/DependInfo.cmake"
+  "thrust/CMakeFiles/thrust.tbb.tbb.cpp17.all.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.adjacent_difference.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.harness.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.adjacent_difference.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.harness.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.adjacent_difference.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.harness.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.adjacent_difference.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.harness.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.adjacent_difference.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.harness.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.adjacent_difference.custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.adjacent_difference.custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.adjacent_difference.custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.adjacent_difference.custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.adjacent_difference.custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.adjacent_difference.in_place.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.adjacent_difference.in_place.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.adjacent_difference.in_place.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.adjacent_difference.in_place.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.adjacent_difference.in_place.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.copy.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.copy.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.copy.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.copy.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.copy.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.copy.if.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.copy.if.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.copy.if.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.copy.if.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.copy.if.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.equal.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.equal.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.equal.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.equal.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.equal.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.fill.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.fill.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.fill.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.fill.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.fill.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.for_each.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.for_each.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.for_each.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.for_each.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.for_each.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.inner_product.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.inner_product.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.inner_product.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.inner_product.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.inner_product.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.merge.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.merge.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.merge.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.merge.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.merge.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.mr.oversized.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.mr.oversized.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.mr.oversized.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.mr.oversized.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.mr.oversized.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.partition.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.partition.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.partition.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.partition.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.partition.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.reduce.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.reduce.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.reduce.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.reduce.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.reduce.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.reduce.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.reduce.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.reduce.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.reduce.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.reduce.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.scan.exclusive.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.scan.exclusive.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.scan.exclusive.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.scan.exclusive.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.scan.exclusive.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.scan.exclusive.max.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.scan.exclusive.max.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.scan.exclusive.max.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.scan.exclusive.max.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.scan.exclusive.max.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.scan.exclusive.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.scan.exclusive.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.scan.exclusive.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.scan.exclusive.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.scan.exclusive.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.scan.inclusive.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.scan.inclusive.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.scan.inclusive.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.scan.inclusive.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.scan.inclusive.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.scan.inclusive.max.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.scan.inclusive.max.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.scan.inclusive.max.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.scan.inclusive.max.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.scan.inclusive.max.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.scan.inclusive.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.scan.inclusive.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.scan.inclusive.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.scan.inclusive.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.scan.inclusive.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.difference.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.difference.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.difference.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.set_operations.difference.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.set_operations.difference.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.difference_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.difference_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.difference_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.set_operations.difference_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.set_operations.difference_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.intersection.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.intersection.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.intersection.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.set_operations.intersection.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.set_operations.intersection.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.intersection_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.intersection_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.intersection_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.set_operations.intersection_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.set_operations.intersection_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.symmetric_difference.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.symmetric_difference.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.symmetric_difference.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.set_operations.symmetric_difference.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.set_operations.symmetric_difference.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.symmetric_difference_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.symmetric_difference_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.symmetric_difference_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.set_operations.symmetric_difference_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.set_operations.symmetric_difference_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.union.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.union.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.union.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.set_operations.union.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.set_operations.union.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.union_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.union_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.union_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.set_operations.union_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.set_operations.union_by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.shuffle.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.shuffle.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.shuffle.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.shuffle.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.shuffle.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.sort.keys.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.sort.keys.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.sort.keys.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.sort.keys.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.sort.keys.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.sort.keys_custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.sort.keys_custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.sort.keys_custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.sort.keys_custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.sort.keys_custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.sort.pairs.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.sort.pairs.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.sort.pairs.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.sort.pairs.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.sort.pairs.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.sort.pairs_custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.sort.pairs_custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.sort.pairs_custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.sort.pairs_custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.sort.pairs_custom.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.sort.radix.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.sort.radix.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.sort.radix.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.sort.radix.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.sort.radix.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.tabulate.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.tabulate.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.tabulate.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.tabulate.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.tabulate.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.transform.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.transform.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.transform.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.transform.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.transform.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.transform_reduce.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.transform_reduce.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.transform_reduce.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.transform_reduce.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.transform_reduce.sum.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.unique.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.unique.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.unique.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.unique.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.unique.basic.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.unique.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.unique.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.unique.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.unique.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.unique.by_key.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.vectorized_search.base.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.vectorized_search.base.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.vectorized_search.base.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.vectorized_search.base.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.vectorized_search.base.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.vectorized_search.lower_bound.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.vectorized_search.lower_bound.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.vectorized_search.lower_bound.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.vectorized_search.lower_bound.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.vectorized_search.lower_bound.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.cpp.cpp17.bench.vectorized_search.upper_bound.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.omp.cpp17.bench.vectorized_search.upper_bound.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.cpp.tbb.cpp17.bench.vectorized_search.upper_bound.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.vectorized_search.upper_bound.base.dir/DependInfo.cmake"
+  "thrust/benchmarks/CMakeFiles/thrust.tbb.tbb.cpp17.bench.vectorized_search.upper_bound.base.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,308 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/adjacent_difference/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/adjacent_difference/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/adjacent_difference/custom.cu"
+  "/root/repo/thrust/benchmarks/bench/adjacent_difference/in_place.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/copy/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/copy/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/copy/if.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/equal/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/equal/basic.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/fill/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/fill/basic.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/for_each/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/for_each/basic.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/inner_product/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/inner_product/basic.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/merge/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/merge/basic.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/mr/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/mr/oversized.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/partition/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/partition/basic.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/reduce/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/reduce/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/reduce/by_key.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/scan/*.cu")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/scan/exclusive/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/scan/exclusive/by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/scan/exclusive/max.cu"
+  "/root/repo/thrust/benchmarks/bench/scan/exclusive/sum.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/scan/inclusive/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/scan/inclusive/by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/scan/inclusive/max.cu"
+  "/root/repo/thrust/benchmarks/bench/scan/inclusive/sum.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/set_operations/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/set_operations/difference.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/difference_by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/intersection.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/intersection_by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference_by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/union.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/union_by_key.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/shuffle/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/shuffle/basic.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/sort/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/sort/keys.cu"
+  "/root/repo/thrust/benchmarks/bench/sort/keys_custom.cu"
+  "/root/repo/thrust/benchmarks/bench/sort/pairs.cu"
+  "/root/repo/thrust/benchmarks/bench/sort/pairs_custom.cu"
+  "/root/repo/thrust/benchmarks/bench/sort/radix.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/tabulate/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/tabulate/basic.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/transform/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/transform/basic.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/transform_reduce/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/transform_reduce/sum.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/unique/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/unique/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/unique/by_key.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# bench_srcs at thrust/benchmarks/CMakeLists.txt:94 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/vectorized_search/*.cu")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/vectorized_search/base.cu"
+  "/root/repo/thrust/benchmarks/bench/vectorized_search/lower_bound.cu"
+  "/root/repo/thrust/benchmarks/bench/vectorized_search/upper_bound.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# contents at thrust/benchmarks/CMakeLists.txt:33 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES true "/root/repo/thrust/benchmarks/bench/*")
+set(OLD_GLOB
+  "/root/repo/thrust/benchmarks/bench/adjacent_difference"
+  "/root/repo/thrust/benchmarks/bench/adjacent_difference/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/adjacent_difference/custom.cu"
+  "/root/repo/thrust/benchmarks/bench/adjacent_difference/in_place.cu"
+  "/root/repo/thrust/benchmarks/bench/copy"
+  "/root/repo/thrust/benchmarks/bench/copy/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/copy/if.cu"
+  "/root/repo/thrust/benchmarks/bench/equal"
+  "/root/repo/thrust/benchmarks/bench/equal/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/fill"
+  "/root/repo/thrust/benchmarks/bench/fill/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/for_each"
+  "/root/repo/thrust/benchmarks/bench/for_each/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/inner_product"
+  "/root/repo/thrust/benchmarks/bench/inner_product/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/merge"
+  "/root/repo/thrust/benchmarks/bench/merge/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/mr"
+  "/root/repo/thrust/benchmarks/bench/mr/oversized.cu"
+  "/root/repo/thrust/benchmarks/bench/partition"
+  "/root/repo/thrust/benchmarks/bench/partition/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/reduce"
+  "/root/repo/thrust/benchmarks/bench/reduce/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/reduce/by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/scan"
+  "/root/repo/thrust/benchmarks/bench/scan/exclusive"
+  "/root/repo/thrust/benchmarks/bench/scan/exclusive/by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/scan/exclusive/max.cu"
+  "/root/repo/thrust/benchmarks/bench/scan/exclusive/sum.cu"
+  "/root/repo/thrust/benchmarks/bench/scan/inclusive"
+  "/root/repo/thrust/benchmarks/bench/scan/inclusive/by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/scan/inclusive/max.cu"
+  "/root/repo/thrust/benchmarks/bench/scan/inclusive/sum.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations"
+  "/root/repo/thrust/benchmarks/bench/set_operations/base.cuh"
+  "/root/repo/thrust/benchmarks/bench/set_operations/by_key.cuh"
+  "/root/repo/thrust/benchmarks/bench/set_operations/difference.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/difference_by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/intersection.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/intersection_by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference_by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/union.cu"
+  "/root/repo/thrust/benchmarks/bench/set_operations/union_by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/shuffle"
+  "/root/repo/thrust/benchmarks/bench/shuffle/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/sort"
+  "/root/repo/thrust/benchmarks/bench/sort/keys.cu"
+  "/root/repo/thrust/benchmarks/bench/sort/keys_custom.cu"
+  "/root/repo/thrust/benchmarks/bench/sort/pairs.cu"
+  "/root/repo/thrust/benchmarks/bench/sort/pairs_custom.cu"
+  "/root/repo/thrust/benchmarks/bench/sort/radix.cu"
+  "/root/repo/thrust/benchmarks/bench/tabulate"
+  "/root/repo/thrust/benchmarks/bench/tabulate/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/transform"
+  "/root/repo/thrust/benchmarks/bench/transform/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/transform_reduce"
+  "/root/repo/thrust/benchmarks/bench/transform_reduce/sum.cu"
+  "/root/repo/thrust/benchmarks/bench/unique"
+  "/root/repo/thrust/benchmarks/bench/unique/basic.cu"
+  "/root/repo/thrust/benchmarks/bench/unique/by_key.cu"
+  "/root/repo/thrust/benchmarks/bench/vectorized_search"
+  "/root/repo/thrust/benchmarks/bench/vectorized_search/base.cu"
+  "/root/repo/thrust/benchmarks/bench/vectorized_search/lower_bound.cu"
+  "/root/repo/thrust/benchmarks/bench/vectorized_search/upper_bound.cu"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench_build/CMakeFiles/cmake.verify_globs")
+endif()
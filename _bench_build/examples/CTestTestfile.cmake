@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples
+# Build directory: /root/repo/_bench_build/examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cccl.example.example_project.default]=] "/usr/bin/ctest" "--build-and-test" "/root/repo/examples/example_project" "/root/repo/_bench_build/examples/example_project/default" "--build-generator" "Unix Makefiles" "--build-options" "-D" "CMAKE_BUILD_TYPE=Release" "-D" "CMAKE_MAKE_PROGRAM=/usr/bin/gmake" "-D" "CMAKE_CXX_COMPILER=/usr/bin/c++" "-D" "CMAKE_CUDA_COMPILER=CMAKE_CUDA_COMPILER-NOTFOUND" "-D" "CMAKE_CUDA_HOST_COMPILER=" "-D" "CMAKE_CUDA_ARCHITECTURES=" "-D" "CCCL_REPOSITORY=nvidia/cccl" "-D" "CCCL_TAG=main" "--test-command" "/usr/bin/ctest" "--output-on-failure")
+set_tests_properties([=[cccl.example.example_project.default]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/CCCLUtilities.cmake;58;add_test;/root/repo/examples/CMakeLists.txt;35;cccl_add_compile_test;/root/repo/examples/CMakeLists.txt;0;")
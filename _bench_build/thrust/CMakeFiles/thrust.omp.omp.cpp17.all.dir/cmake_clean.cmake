@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/thrust.omp.omp.cpp17.all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
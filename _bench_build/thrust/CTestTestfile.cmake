@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thrust
+# Build directory: /root/repo/_bench_build/thrust
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("benchmarks")
@@ -0,0 +1,2 @@
+# CMAKE generated file: DO NOT EDIT!
+# Timestamp file for compiler generated dependencies management for thrust.cpp.cpp.cpp17.bench.adjacent_difference.in_place.base.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.cpp.cpp.cpp17.bench.scan.inclusive.max.base"
+  "../../bin/thrust.cpp.cpp.cpp17.bench.scan.inclusive.max.base.pdb"
+  "CMakeFiles/thrust.cpp.cpp.cpp17.bench.scan.inclusive.max.base.dir/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/max.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.cpp.cpp17.bench.scan.inclusive.max.base.dir/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/scan/inclusive/max.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.cpp.cpp17.bench.scan.inclusive.max.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
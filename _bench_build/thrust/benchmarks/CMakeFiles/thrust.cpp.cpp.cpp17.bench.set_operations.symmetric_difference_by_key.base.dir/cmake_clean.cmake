@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.cpp.cpp.cpp17.bench.set_operations.symmetric_difference_by_key.base"
+  "../../bin/thrust.cpp.cpp.cpp17.bench.set_operations.symmetric_difference_by_key.base.pdb"
+  "CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.symmetric_difference_by_key.base.dir/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference_by_key.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.symmetric_difference_by_key.base.dir/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference_by_key.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.cpp.cpp17.bench.set_operations.symmetric_difference_by_key.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
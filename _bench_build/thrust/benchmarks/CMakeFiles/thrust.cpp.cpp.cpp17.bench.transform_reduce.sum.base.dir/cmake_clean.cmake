@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.cpp.cpp.cpp17.bench.transform_reduce.sum.base"
+  "../../bin/thrust.cpp.cpp.cpp17.bench.transform_reduce.sum.base.pdb"
+  "CMakeFiles/thrust.cpp.cpp.cpp17.bench.transform_reduce.sum.base.dir/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/transform_reduce/sum.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.cpp.cpp17.bench.transform_reduce.sum.base.dir/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/transform_reduce/sum.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.cpp.cpp17.bench.transform_reduce.sum.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
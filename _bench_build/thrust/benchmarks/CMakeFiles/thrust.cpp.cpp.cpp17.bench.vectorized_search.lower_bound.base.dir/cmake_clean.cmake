@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.cpp.cpp.cpp17.bench.vectorized_search.lower_bound.base"
+  "../../bin/thrust.cpp.cpp.cpp17.bench.vectorized_search.lower_bound.base.pdb"
+  "CMakeFiles/thrust.cpp.cpp.cpp17.bench.vectorized_search.lower_bound.base.dir/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/lower_bound.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.cpp.cpp17.bench.vectorized_search.lower_bound.base.dir/thrust.cpp.cpp.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/lower_bound.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.cpp.cpp17.bench.vectorized_search.lower_bound.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libthrust.cpp.omp.cpp17.bench.harness.a"
+  "../../lib/libthrust.cpp.omp.cpp17.bench.harness.pdb"
+  "CMakeFiles/thrust.cpp.omp.cpp17.bench.harness.dir/host/main.cpp.o"
+  "CMakeFiles/thrust.cpp.omp.cpp17.bench.harness.dir/host/main.cpp.o.d"
+  "CMakeFiles/thrust.cpp.omp.cpp17.bench.harness.dir/thrust.cpp.omp.cpp17/root/repo/cub/benchmarks/nvbench_helper/nvbench_helper/nvbench_helper.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.omp.cpp17.bench.harness.dir/thrust.cpp.omp.cpp17/root/repo/cub/benchmarks/nvbench_helper/nvbench_helper/nvbench_helper.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.omp.cpp17.bench.harness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
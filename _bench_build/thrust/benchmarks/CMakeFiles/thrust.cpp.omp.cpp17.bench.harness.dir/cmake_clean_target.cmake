@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../../lib/libthrust.cpp.omp.cpp17.bench.harness.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.cpp.omp.cpp17.bench.set_operations.difference.base"
+  "../../bin/thrust.cpp.omp.cpp17.bench.set_operations.difference.base.pdb"
+  "CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.difference.base.dir/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.difference.base.dir/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/set_operations/difference.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.omp.cpp17.bench.set_operations.difference.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
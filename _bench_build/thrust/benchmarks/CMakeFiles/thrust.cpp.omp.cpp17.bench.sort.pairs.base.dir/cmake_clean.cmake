@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.cpp.omp.cpp17.bench.sort.pairs.base"
+  "../../bin/thrust.cpp.omp.cpp17.bench.sort.pairs.base.pdb"
+  "CMakeFiles/thrust.cpp.omp.cpp17.bench.sort.pairs.base.dir/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.omp.cpp17.bench.sort.pairs.base.dir/thrust.cpp.omp.cpp17/root/repo/thrust/benchmarks/bench/sort/pairs.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.omp.cpp17.bench.sort.pairs.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
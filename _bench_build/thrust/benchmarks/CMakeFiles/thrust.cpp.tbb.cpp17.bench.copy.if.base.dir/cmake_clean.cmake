@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.cpp.tbb.cpp17.bench.copy.if.base"
+  "../../bin/thrust.cpp.tbb.cpp17.bench.copy.if.base.pdb"
+  "CMakeFiles/thrust.cpp.tbb.cpp17.bench.copy.if.base.dir/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/copy/if.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.tbb.cpp17.bench.copy.if.base.dir/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/copy/if.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.tbb.cpp17.bench.copy.if.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.cpp.tbb.cpp17.bench.reduce.by_key.base"
+  "../../bin/thrust.cpp.tbb.cpp17.bench.reduce.by_key.base.pdb"
+  "CMakeFiles/thrust.cpp.tbb.cpp17.bench.reduce.by_key.base.dir/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/reduce/by_key.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.tbb.cpp17.bench.reduce.by_key.base.dir/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/reduce/by_key.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.tbb.cpp17.bench.reduce.by_key.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.cpp.tbb.cpp17.bench.set_operations.intersection.base"
+  "../../bin/thrust.cpp.tbb.cpp17.bench.set_operations.intersection.base.pdb"
+  "CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.intersection.base.dir/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.intersection.base.dir/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/set_operations/intersection.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.tbb.cpp17.bench.set_operations.intersection.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
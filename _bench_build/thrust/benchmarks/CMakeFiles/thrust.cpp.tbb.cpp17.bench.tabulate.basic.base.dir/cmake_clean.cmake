@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.cpp.tbb.cpp17.bench.tabulate.basic.base"
+  "../../bin/thrust.cpp.tbb.cpp17.bench.tabulate.basic.base.pdb"
+  "CMakeFiles/thrust.cpp.tbb.cpp17.bench.tabulate.basic.base.dir/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/tabulate/basic.cu.cpp.o"
+  "CMakeFiles/thrust.cpp.tbb.cpp17.bench.tabulate.basic.base.dir/thrust.cpp.tbb.cpp17/root/repo/thrust/benchmarks/bench/tabulate/basic.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.cpp.tbb.cpp17.bench.tabulate.basic.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,2 @@
+# CMAKE generated file: DO NOT EDIT!
+# Timestamp file for compiler generated dependencies management for thrust.omp.omp.cpp17.bench.adjacent_difference.basic.base.
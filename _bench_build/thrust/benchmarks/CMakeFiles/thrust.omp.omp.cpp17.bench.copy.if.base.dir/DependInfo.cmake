@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_bench_build/thrust/benchmarks/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/copy/if.cu.cpp" "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.copy.if.base.dir/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/copy/if.cu.cpp.o" "gcc" "thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.copy.if.base.dir/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/copy/if.cu.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/thrust/benchmarks/CMakeFiles/thrust.omp.omp.cpp17.bench.harness.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.omp.omp.cpp17.bench.fill.basic.base"
+  "../../bin/thrust.omp.omp.cpp17.bench.fill.basic.base.pdb"
+  "CMakeFiles/thrust.omp.omp.cpp17.bench.fill.basic.base.dir/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/fill/basic.cu.cpp.o"
+  "CMakeFiles/thrust.omp.omp.cpp17.bench.fill.basic.base.dir/thrust.omp.omp.cpp17/root/repo/thrust/benchmarks/bench/fill/basic.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.omp.omp.cpp17.bench.fill.basic.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
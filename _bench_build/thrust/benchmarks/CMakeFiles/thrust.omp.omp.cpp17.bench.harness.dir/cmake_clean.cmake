@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libthrust.omp.omp.cpp17.bench.harness.a"
+  "../../lib/libthrust.omp.omp.cpp17.bench.harness.pdb"
+  "CMakeFiles/thrust.omp.omp.cpp17.bench.harness.dir/host/main.cpp.o"
+  "CMakeFiles/thrust.omp.omp.cpp17.bench.harness.dir/host/main.cpp.o.d"
+  "CMakeFiles/thrust.omp.omp.cpp17.bench.harness.dir/thrust.omp.omp.cpp17/root/repo/cub/benchmarks/nvbench_helper/nvbench_helper/nvbench_helper.cu.cpp.o"
+  "CMakeFiles/thrust.omp.omp.cpp17.bench.harness.dir/thrust.omp.omp.cpp17/root/repo/cub/benchmarks/nvbench_helper/nvbench_helper/nvbench_helper.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.omp.omp.cpp17.bench.harness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../../lib/libthrust.omp.omp.cpp17.bench.harness.a"
+)
@@ -0,0 +1,2 @@
+# CMAKE generated file: DO NOT EDIT!
+# Timestamp file for compiler generated dependencies management for thrust.tbb.tbb.cpp17.bench.adjacent_difference.in_place.base.
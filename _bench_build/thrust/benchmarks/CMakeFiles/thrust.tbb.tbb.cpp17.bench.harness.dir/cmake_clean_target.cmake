@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../../lib/libthrust.tbb.tbb.cpp17.bench.harness.a"
+)
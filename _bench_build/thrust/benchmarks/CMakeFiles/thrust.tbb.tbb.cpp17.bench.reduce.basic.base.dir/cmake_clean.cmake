@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.tbb.tbb.cpp17.bench.reduce.basic.base"
+  "../../bin/thrust.tbb.tbb.cpp17.bench.reduce.basic.base.pdb"
+  "CMakeFiles/thrust.tbb.tbb.cpp17.bench.reduce.basic.base.dir/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/reduce/basic.cu.cpp.o"
+  "CMakeFiles/thrust.tbb.tbb.cpp17.bench.reduce.basic.base.dir/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/reduce/basic.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.tbb.tbb.cpp17.bench.reduce.basic.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
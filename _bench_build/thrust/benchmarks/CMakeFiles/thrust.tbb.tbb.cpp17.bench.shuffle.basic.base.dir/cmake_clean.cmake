@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.tbb.tbb.cpp17.bench.shuffle.basic.base"
+  "../../bin/thrust.tbb.tbb.cpp17.bench.shuffle.basic.base.pdb"
+  "CMakeFiles/thrust.tbb.tbb.cpp17.bench.shuffle.basic.base.dir/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/shuffle/basic.cu.cpp.o"
+  "CMakeFiles/thrust.tbb.tbb.cpp17.bench.shuffle.basic.base.dir/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/shuffle/basic.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.tbb.tbb.cpp17.bench.shuffle.basic.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
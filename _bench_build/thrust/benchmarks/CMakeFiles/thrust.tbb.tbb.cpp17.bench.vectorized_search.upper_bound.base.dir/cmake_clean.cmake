@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/thrust.tbb.tbb.cpp17.bench.vectorized_search.upper_bound.base"
+  "../../bin/thrust.tbb.tbb.cpp17.bench.vectorized_search.upper_bound.base.pdb"
+  "CMakeFiles/thrust.tbb.tbb.cpp17.bench.vectorized_search.upper_bound.base.dir/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/upper_bound.cu.cpp.o"
+  "CMakeFiles/thrust.tbb.tbb.cpp17.bench.vectorized_search.upper_bound.base.dir/thrust.tbb.tbb.cpp17/root/repo/thrust/benchmarks/bench/vectorized_search/upper_bound.cu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thrust.tbb.tbb.cpp17.bench.vectorized_search.upper_bound.base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
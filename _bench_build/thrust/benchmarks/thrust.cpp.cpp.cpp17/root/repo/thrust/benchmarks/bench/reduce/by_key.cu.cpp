@@ -0,0 +1 @@
+#include </root/repo/thrust/benchmarks/bench/reduce/by_key.cu>
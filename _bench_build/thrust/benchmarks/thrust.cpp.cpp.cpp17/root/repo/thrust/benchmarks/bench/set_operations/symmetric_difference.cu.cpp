@@ -0,0 +1 @@
+#include </root/repo/thrust/benchmarks/bench/set_operations/symmetric_difference.cu>
@@ -0,0 +1 @@
+#include </root/repo/thrust/benchmarks/bench/vectorized_search/lower_bound.cu>
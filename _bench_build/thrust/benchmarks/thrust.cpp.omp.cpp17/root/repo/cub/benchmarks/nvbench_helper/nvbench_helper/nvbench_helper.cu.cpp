@@ -0,0 +1 @@
+#include </root/repo/cub/benchmarks/nvbench_helper/nvbench_helper/nvbench_helper.cu>
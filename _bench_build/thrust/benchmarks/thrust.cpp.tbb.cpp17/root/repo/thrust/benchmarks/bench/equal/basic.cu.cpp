@@ -0,0 +1 @@
+#include </root/repo/thrust/benchmarks/bench/equal/basic.cu>
@@ -0,0 +1 @@
+#include </root/repo/thrust/benchmarks/bench/transform/basic.cu>
@@ -0,0 +1 @@
+#include </root/repo/thrust/benchmarks/bench/copy/if.cu>
@@ -0,0 +1 @@
+#include </root/repo/thrust/benchmarks/bench/for_each/basic.cu>
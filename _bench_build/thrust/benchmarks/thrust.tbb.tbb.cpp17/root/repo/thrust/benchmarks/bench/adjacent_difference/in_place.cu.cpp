@@ -0,0 +1 @@
+#include </root/repo/thrust/benchmarks/bench/adjacent_difference/in_place.cu>
@@ -0,0 +1 @@
+#include </root/repo/thrust/benchmarks/bench/inner_product/basic.cu>
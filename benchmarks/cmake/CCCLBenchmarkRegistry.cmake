@@ -1,4 +1,5 @@
-find_package(CUDAToolkit REQUIRED)
+# Host-only builds (Thrust's CPP/OMP/TBB benchmarks) have no CUDA Toolkit
+find_package(CUDAToolkit QUIET)
 
 set(cccl_revision "")
 find_package(Git)
@@ -36,6 +37,9 @@ function(create_benchmark_registry)
   get_meta_path(meta_path)
 
   set(ctk_version "${CUDAToolkit_VERSION}")
+  if ("${ctk_version}" STREQUAL "")
+    set(ctk_version "0.0.0")
+  endif()
   message(STATUS "CTK version: ${ctk_version}")
 
   file(REMOVE "${meta_path}")
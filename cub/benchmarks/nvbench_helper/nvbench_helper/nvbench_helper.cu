@@ -1,4 +1,8 @@
-#include <cub/device/device_copy.cuh>
+#include <thrust/detail/config.h>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+#  include <cub/device/device_copy.cuh>
+#endif
 
 #include <thrust/binary_search.h>
 #include <thrust/count.h>
@@ -15,12 +19,17 @@
 #include <thrust/scan.h>
 #include <thrust/tabulate.h>
 
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <optional>
 #include <random>
 #include <type_traits>
 
 #include "thrust/device_vector.h"
-#include <curand.h>
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+#  include <curand.h>
+#endif
 #include <nvbench_helper.cuh>
 
 namespace
@@ -89,6 +98,7 @@ const double* host_generator_t::new_constant(std::size_t num_items, double val)
   return h_distribution;
 }
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 class device_generator_t
 {
 public:
@@ -113,6 +123,11 @@ private:
   curandGenerator_t m_gen;
   thrust::device_vector<double> m_distribution;
 };
+#else
+// Host device systems share the host generator; device memory is host memory
+class device_generator_t : public host_generator_t
+{};
+#endif
 
 template <typename T>
 struct random_to_item_t
@@ -138,6 +153,8 @@ struct random_to_item_t
   }
 };
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+
 const double* device_generator_t::new_uniform_distribution(seed_t seed, std::size_t num_items)
 {
   m_distribution.resize(num_items);
@@ -167,6 +184,16 @@ const double* device_generator_t::new_constant(std::size_t num_items, double val
   thrust::fill_n(thrust::device, d_distribution, num_items, val);
   return d_distribution;
 }
+#endif
+
+template <class To, class From>
+__host__ __device__ To bit_cast(const From& from)
+{
+  static_assert(sizeof(To) == sizeof(From), "");
+  To to;
+  memcpy(&to, &from, sizeof(To));
+  return to;
+}
 
 struct and_t
 {
@@ -178,14 +205,14 @@ struct and_t
 
   __host__ __device__ float operator()(float a, float b) const
   {
-    const std::uint32_t result = reinterpret_cast<std::uint32_t&>(a) & reinterpret_cast<std::uint32_t&>(b);
-    return reinterpret_cast<const float&>(result);
+    const std::uint32_t result = bit_cast<std::uint32_t>(a) & bit_cast<std::uint32_t>(b);
+    return bit_cast<float>(result);
   }
 
   __host__ __device__ double operator()(double a, double b) const
   {
-    const std::uint64_t result = reinterpret_cast<std::uint64_t&>(a) & reinterpret_cast<std::uint64_t&>(b);
-    return reinterpret_cast<const double&>(result);
+    const std::uint64_t result = bit_cast<std::uint64_t>(a) & bit_cast<std::uint64_t>(b);
+    return bit_cast<double>(result);
   }
 
   __host__ __device__ complex operator()(complex a, complex b) const
@@ -197,13 +224,13 @@ struct and_t
     double b_imag = b.imag();
 
     const std::uint64_t result_real =
-      reinterpret_cast<std::uint64_t&>(a_real) & reinterpret_cast<std::uint64_t&>(b_real);
+      bit_cast<std::uint64_t>(a_real) & bit_cast<std::uint64_t>(b_real);
 
     const std::uint64_t result_imag =
-      reinterpret_cast<std::uint64_t&>(a_imag) & reinterpret_cast<std::uint64_t&>(b_imag);
+      bit_cast<std::uint64_t>(a_imag) & bit_cast<std::uint64_t>(b_imag);
 
-    return {static_cast<float>(reinterpret_cast<const double&>(result_real)),
-            static_cast<float>(reinterpret_cast<const double&>(result_imag))};
+    return {static_cast<float>(bit_cast<double>(result_real)),
+            static_cast<float>(bit_cast<double>(result_imag))};
   }
 };
 
@@ -489,7 +516,8 @@ void generator_t::power_law_segment_offsets(
   const std::size_t total_segments   = device_segment_offsets.size() - 1;
   const double* uniform_distribution = dist.new_lognormal_distribution(seed, total_segments);
 
-  if (thrust::count(exec, uniform_distribution, uniform_distribution + total_segments, 0.0) == total_segments)
+  if (static_cast<std::size_t>(thrust::count(exec, uniform_distribution, uniform_distribution + total_segments, 0.0))
+      == total_segments)
   {
     uniform_distribution = dist.new_constant(total_segments, 1.0);
   }
@@ -576,7 +604,7 @@ struct offset_to_size_t
 };
 
 template <typename T>
-void gen_key_segments(executor exec, seed_t seed, cuda::std::span<T> keys, cuda::std::span<std::size_t> segment_offsets)
+void gen_key_segments(executor exec, seed_t, cuda::std::span<T> keys, cuda::std::span<std::size_t> segment_offsets)
 {
   thrust::counting_iterator<int> iota(0);
   offset_to_iterator_t<T> dst_transform_op{keys.data()};
@@ -587,6 +615,7 @@ void gen_key_segments(executor exec, seed_t seed, cuda::std::span<T> keys, cuda:
   auto d_range_dsts  = thrust::make_transform_iterator(segment_offsets.data(), dst_transform_op);
   auto d_range_sizes = thrust::make_transform_iterator(iota, offset_to_size_t{segment_offsets.data()});
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
   if (exec == executor::device)
   {
     std::uint8_t* d_temp_storage   = nullptr;
@@ -602,6 +631,9 @@ void gen_key_segments(executor exec, seed_t seed, cuda::std::span<T> keys, cuda:
     cudaDeviceSynchronize();
   }
   else
+#else
+  (void) exec;
+#endif
   {
     for (std::size_t sid = 0; sid < total_segments; sid++)
     {
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Allocates and then frees a batch of oversized blocks of random sizes from a pool, so that every allocation looks
+// for a fitting block among the blocks the previous batch left in the cache.
+static void basic(nvbench::state& state)
+{
+  using pool_t = thrust::mr::unsynchronized_pool_resource<thrust::mr::new_delete_resource>;
+
+  const auto blocks = static_cast<std::size_t>(state.get_int64("Blocks"));
+
+  // every block above 4 KiB is oversized; keeping them small lets thousands of them be cached at once
+  thrust::mr::pool_options options = pool_t::get_default_options();
+  options.largest_block_size       = 1 << 12;
+
+  thrust::mr::new_delete_resource upstream;
+  pool_t pool(&upstream, options);
+
+  // sizes spread evenly over 8 KiB to 2 MiB on a log scale, freed in a different order than allocated
+  std::mt19937_64 rng(42);
+  std::vector<std::size_t> sizes(blocks);
+  for (std::size_t& size : sizes)
+  {
+    const std::size_t octave = std::size_t{1} << std::uniform_int_distribution<int>(13, 20)(rng);
+    size                     = octave + std::uniform_int_distribution<std::size_t>(0, octave - 1)(rng);
+  }
+
+  std::vector<std::size_t> order(blocks);
+  for (std::size_t i = 0; i < blocks; ++i)
+  {
+    order[i] = i;
+  }
+  std::shuffle(order.begin(), order.end(), rng);
+
+  std::vector<void*> pointers(blocks);
+
+  state.add_element_count(blocks);
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    for (std::size_t i = 0; i < blocks; ++i)
+    {
+      pointers[i] = pool.do_allocate(sizes[i]);
+    }
+    for (std::size_t i : order)
+    {
+      pool.do_deallocate(pointers[i], sizes[i]);
+    }
+  });
+}
+
+NVBENCH_BENCH(basic).set_name("base").add_int64_power_of_two_axis("Blocks", nvbench::range(4, 12, 2));
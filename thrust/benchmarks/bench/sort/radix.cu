@@ -0,0 +1,274 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+#include <cstdint>
+
+#include "nvbench_helper.cuh"
+
+// Compares the engines of the sequential radix sort on host memory: "scatter" is the LSD sort as it was before the
+// tuned engine, which scattered every pass through a transform_iterator, "tuned" is what thrust::stable_sort picks for
+// the key size and input size, and "in-place" is the MSD sort used by keys-only sorts too large for a temporary copy.
+namespace radix_sort_detail = thrust::system::detail::sequential::radix_sort_detail;
+
+namespace scatter_baseline
+{
+
+// returns a key's histogram bucket count and post-increments the bucket
+template <unsigned int RadixBits, typename KeyType>
+struct bucket_functor
+{
+  using Encoder     = radix_sort_detail::RadixEncoder<KeyType>;
+  using EncodedType = decltype(::cuda::std::declval<Encoder>()(::cuda::std::declval<KeyType>()));
+  using result_type = std::size_t;
+
+  Encoder encode;
+  EncodedType bit_shift;
+  std::size_t* histogram;
+
+  bucket_functor(EncodedType bit_shift, std::size_t* histogram)
+      : encode()
+      , bit_shift(bit_shift)
+      , histogram(histogram)
+  {}
+
+  std::size_t operator()(KeyType key)
+  {
+    const EncodedType x = encode(key);
+
+    // note that we mutate the histogram here
+    return histogram[(x >> bit_shift) & ((1 << RadixBits) - 1)]++;
+  }
+};
+
+template <unsigned int RadixBits, bool HasValues, typename KeyIt, typename ValueIt>
+void radix_sort(KeyIt keys1, KeyIt keys2, ValueIt vals1, ValueIt vals2, const std::size_t N)
+{
+  using KeyType     = typename thrust::iterator_value<KeyIt>::type;
+  using Encoder     = radix_sort_detail::RadixEncoder<KeyType>;
+  using EncodedType = decltype(::cuda::std::declval<Encoder>()(::cuda::std::declval<KeyType>()));
+
+  const unsigned int NumHistograms = (8 * sizeof(EncodedType) + (RadixBits - 1)) / RadixBits;
+  const unsigned int HistogramSize = 1 << RadixBits;
+
+  Encoder encode;
+
+  std::size_t histograms[NumHistograms][HistogramSize] = {{0}};
+  bool skip_shuffle[NumHistograms]                     = {false};
+
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
+
+  for (std::size_t i = 0; i < N; i++)
+  {
+    const EncodedType x = encode(keys1[i]);
+
+    for (unsigned int j = 0; j < NumHistograms; j++)
+    {
+      histograms[j][(x >> (RadixBits * j)) & (HistogramSize - 1)]++;
+    }
+  }
+
+  for (unsigned int i = 0; i < NumHistograms; i++)
+  {
+    std::size_t sum = 0;
+
+    for (unsigned int j = 0; j < HistogramSize; j++)
+    {
+      std::size_t bin = histograms[i][j];
+
+      skip_shuffle[i] = skip_shuffle[i] || bin == N;
+
+      histograms[i][j] = sum;
+
+      sum = sum + bin;
+    }
+  }
+
+  for (unsigned int i = 0; i < NumHistograms; i++)
+  {
+    if (skip_shuffle[i])
+    {
+      continue;
+    }
+
+    KeyIt keys_in    = flip ? keys2 : keys1;
+    KeyIt keys_out   = flip ? keys1 : keys2;
+    ValueIt vals_in  = flip ? vals2 : vals1;
+    ValueIt vals_out = flip ? vals1 : vals2;
+
+    auto buckets = thrust::make_transform_iterator(
+      keys_in, bucket_functor<RadixBits, KeyType>(static_cast<EncodedType>(RadixBits * i), histograms[i]));
+
+    // note that we are going to mutate the histogram during this sequential scatter
+    if (HasValues)
+    {
+      thrust::scatter(thrust::seq,
+                      thrust::make_zip_iterator(keys_in, vals_in),
+                      thrust::make_zip_iterator(keys_in + N, vals_in + N),
+                      buckets,
+                      thrust::make_zip_iterator(keys_out, vals_out));
+    }
+    else
+    {
+      thrust::scatter(thrust::seq, keys_in, keys_in + N, buckets, keys_out);
+    }
+
+    flip = !flip;
+  }
+
+  // ensure final values are in (keys1,vals1)
+  if (flip)
+  {
+    thrust::copy(thrust::seq, keys2, keys2 + N, keys1);
+
+    if (HasValues)
+    {
+      thrust::copy(thrust::seq, vals2, vals2 + N, vals1);
+    }
+  }
+}
+
+// the digit widths the old engine picked for 4- and 8-byte keys
+template <bool HasValues, typename KeyIt, typename ValueIt>
+void radix_sort(KeyIt keys1, KeyIt keys2, ValueIt vals1, ValueIt vals2, const std::size_t N)
+{
+  using KeyType = typename thrust::iterator_value<KeyIt>::type;
+
+  if (N < (sizeof(KeyType) == 8 ? (1 << 21) : (1 << 22)))
+  {
+    radix_sort<8, HasValues>(keys1, keys2, vals1, vals2, N);
+  }
+  else
+  {
+    radix_sort<HasValues ? 3 : 4, HasValues>(keys1, keys2, vals1, vals2, N);
+  }
+}
+
+} // namespace scatter_baseline
+
+template <typename T>
+static void keys(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements       = static_cast<std::size_t>(state.get_int64("Elements"));
+  const bit_entropy entropy = str_to_entropy(state.get_string("Entropy"));
+  const std::string engine  = state.get_string("Engine");
+
+  const thrust::host_vector<T> input = thrust::device_vector<T>(generate(elements, entropy));
+
+  thrust::host_vector<T> vec(elements);
+  thrust::host_vector<T> temp(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  // the sequential sorts take a mutable policy
+  thrust::detail::seq_t exec;
+
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync, [&](nvbench::launch&, auto& timer) {
+    vec = input;
+    timer.start();
+    if (engine == "scatter")
+    {
+      scatter_baseline::radix_sort<false>(vec.begin(), temp.begin(), vec.begin(), temp.begin(), elements);
+    }
+    else if (engine == "tuned")
+    {
+      radix_sort_detail::radix_sort(exec, vec.begin(), temp.begin(), elements);
+    }
+    else
+    {
+      radix_sort_detail::in_place_radix_sort(vec.begin(), elements, 8 * sizeof(T) - 8);
+    }
+    timer.stop();
+  });
+}
+
+template <typename KeyT, typename ValueT>
+static void pairs(nvbench::state& state, nvbench::type_list<KeyT, ValueT>)
+{
+  const auto elements       = static_cast<std::size_t>(state.get_int64("Elements"));
+  const bit_entropy entropy = str_to_entropy(state.get_string("Entropy"));
+  const std::string engine  = state.get_string("Engine");
+
+  const thrust::host_vector<KeyT> in_keys   = thrust::device_vector<KeyT>(generate(elements, entropy));
+  const thrust::host_vector<ValueT> in_vals = thrust::device_vector<ValueT>(generate(elements));
+
+  thrust::host_vector<KeyT> keys(elements);
+  thrust::host_vector<KeyT> temp_keys(elements);
+  thrust::host_vector<ValueT> vals(elements);
+  thrust::host_vector<ValueT> temp_vals(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<KeyT>(elements);
+  state.add_global_memory_reads<ValueT>(elements);
+  state.add_global_memory_writes<KeyT>(elements);
+  state.add_global_memory_writes<ValueT>(elements);
+
+  // the sequential sorts take a mutable policy
+  thrust::detail::seq_t exec;
+
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync, [&](nvbench::launch&, auto& timer) {
+    keys = in_keys;
+    vals = in_vals;
+    timer.start();
+    if (engine == "scatter")
+    {
+      scatter_baseline::radix_sort<true>(keys.begin(), temp_keys.begin(), vals.begin(), temp_vals.begin(), elements);
+    }
+    else
+    {
+      radix_sort_detail::radix_sort(exec, keys.begin(), temp_keys.begin(), vals.begin(), temp_vals.begin(), elements);
+    }
+    timer.stop();
+  });
+}
+
+using key_types   = nvbench::type_list<std::uint32_t, std::uint64_t, float, double>;
+using value_types = nvbench::type_list<std::uint32_t, std::uint64_t>;
+
+NVBENCH_BENCH_TYPES(keys, NVBENCH_TYPE_AXES(key_types))
+  .set_name("keys")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.201"})
+  .add_string_axis("Engine", {"scatter", "tuned", "in-place"});
+
+NVBENCH_BENCH_TYPES(pairs, NVBENCH_TYPE_AXES(key_types, value_types))
+  .set_name("pairs")
+  .set_type_axes_names({"KeyT{ct}", "ValueT{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.201"})
+  .add_string_axis("Engine", {"scatter", "tuned"});
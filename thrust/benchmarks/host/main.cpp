@@ -0,0 +1,857 @@
+// SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Runner for the host configurations of thrust/benchmarks; see nvbench/nvbench.cuh.
+//
+// The command line follows NVBench's where benchmarks/scripts rely on it:
+//
+//   --list, -l                  list benchmarks and their axes
+//   --jsonlist-benches          print the benchmarks and their axes as JSON
+//   --jsonlist-devices          print the host "device" as JSON
+//   --benchmark, -b <name|idx>  run only the given benchmark (repeatable)
+//   --axis, -a <spec>           override axis values, e.g. "Elements[pow2]=[16,20]",
+//                               "T{ct}=[I32,I64]" or "Threads=[1,2,4]"; applies to
+//                               the preceding -b, or to every benchmark before any -b
+//   --json, --jsonbin <path>    write results to <path>, and samples to <path>-bin/
+//   --min-samples <n>           samples per state, 10 by default
+//   --min-time <seconds>        minimum measured time per state, 0.5 by default
+//   --timeout <seconds>         maximum time per state, 15 by default
+//
+// --device/-d and --stopping-criterion are accepted and ignored. The OMP and
+// TBB configurations add a Threads axis to every benchmark, sweeping powers of
+// two up to the number of hardware threads.
+
+#include <thrust/detail/config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#endif
+
+namespace
+{
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+const char* system_name   = "OMP";
+const bool has_thread_axis = true;
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+const char* system_name   = "TBB";
+const bool has_thread_axis = true;
+#else
+const char* system_name   = "CPP";
+const bool has_thread_axis = false;
+#endif
+
+const char* threads_axis_name = "Threads";
+
+int hardware_threads()
+{
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+// Runs a state with at most num_threads threads in the backend's pool.
+class thread_limit
+{
+public:
+  explicit thread_limit(int num_threads)
+  {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    m_previous = omp_get_max_threads();
+    omp_set_num_threads(num_threads);
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+    m_control.emplace(::tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(num_threads));
+#else
+    (void) num_threads;
+#endif
+  }
+
+  ~thread_limit()
+  {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    omp_set_num_threads(m_previous);
+#endif
+  }
+
+  thread_limit(const thread_limit&)            = delete;
+  thread_limit& operator=(const thread_limit&) = delete;
+
+private:
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  int m_previous;
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  std::optional<::tbb::global_control> m_control;
+#endif
+};
+
+std::string cpu_name()
+{
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+
+  while (std::getline(cpuinfo, line))
+  {
+    if (line.rfind("model name", 0) == 0)
+    {
+      const std::size_t colon = line.find(':');
+      if (colon != std::string::npos)
+      {
+        return line.substr(line.find_first_not_of(' ', colon + 1));
+      }
+    }
+  }
+
+  return "Host";
+}
+
+std::string device_name()
+{
+  return cpu_name() + " (" + system_name + ")";
+}
+
+// Minimal JSON emission
+
+std::string quote(const std::string& str)
+{
+  std::string result = "\"";
+
+  for (char c : str)
+  {
+    switch (c)
+    {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        result += c;
+    }
+  }
+
+  return result + "\"";
+}
+
+template <typename Range, typename Function>
+std::string json_array(const Range& range, Function f)
+{
+  std::string result = "[";
+
+  for (auto iter = std::begin(range); iter != std::end(range); ++iter)
+  {
+    if (iter != std::begin(range))
+    {
+      result += ", ";
+    }
+    result += f(*iter);
+  }
+
+  return result + "]";
+}
+
+std::string axis_type_name(nvbench::axis_type type)
+{
+  switch (type)
+  {
+    case nvbench::axis_type::type:
+      return "type";
+    case nvbench::axis_type::int64:
+      return "int64";
+    case nvbench::axis_type::float64:
+      return "float64";
+    default:
+      return "string";
+  }
+}
+
+std::string device_json()
+{
+  std::ostringstream out;
+  out << "{\"id\": 0, \"name\": " << quote(device_name()) << ", \"number_of_sms\": " << hardware_threads()
+      << ", \"global_memory_bus_width\": 0, \"ecc_state\": false}";
+  return out.str();
+}
+
+std::string axis_json(const nvbench::axis& a)
+{
+  std::vector<std::size_t> indices(a.input_strings.size());
+  std::iota(indices.begin(), indices.end(), std::size_t{0});
+
+  std::ostringstream out;
+  out << "{\"name\": " << quote(a.name) << ", \"type\": " << quote(axis_type_name(a.type))
+      << ", \"flags\": " << quote(a.flags) << ", \"values\": " << json_array(indices, [&](std::size_t i) {
+           std::string value = "{\"input_string\": " + quote(a.input_strings[i])
+                             + ", \"description\": " + quote(a.descriptions[i]);
+           if (a.type == nvbench::axis_type::int64)
+           {
+             value += ", \"value\": " + std::to_string(a.int64_values[i]);
+           }
+           return value + "}";
+         })
+      << "}";
+  return out.str();
+}
+
+std::string summary_json(
+  const std::string& tag, const std::string& name, const std::string& type, const std::string& value)
+{
+  return "{\"tag\": " + quote(tag) + ", \"name\": " + quote(name) + ", \"data\": [{\"name\": \"value\", \"type\": "
+       + quote(type) + ", \"value\": " + quote(value) + "}]}";
+}
+
+std::string to_string(double value)
+{
+  std::ostringstream out;
+  out.precision(17);
+  out << value;
+  return out.str();
+}
+
+// Axis selection
+
+struct axis_override
+{
+  int benchmark; // -1 for every benchmark
+  std::string name;
+  std::string flags;
+  std::vector<std::string> values;
+};
+
+std::vector<std::string> split(const std::string& str, char delimiter)
+{
+  std::vector<std::string> result;
+  std::stringstream stream(str);
+  std::string item;
+
+  while (std::getline(stream, item, delimiter))
+  {
+    result.push_back(item);
+  }
+
+  return result;
+}
+
+axis_override parse_axis_override(int benchmark, const std::string& spec)
+{
+  const std::size_t equals = spec.find('=');
+  if (equals == std::string::npos)
+  {
+    throw std::runtime_error("invalid axis specification: " + spec);
+  }
+
+  axis_override result{benchmark, spec.substr(0, equals), "", {}};
+
+  const std::size_t bracket = result.name.rfind('[');
+  if (bracket != std::string::npos && result.name.back() == ']')
+  {
+    result.flags = result.name.substr(bracket + 1, result.name.size() - bracket - 2);
+    result.name  = result.name.substr(0, bracket);
+  }
+
+  std::string values = spec.substr(equals + 1);
+  if (values.size() >= 2 && values.front() == '[' && values.back() == ']')
+  {
+    values = values.substr(1, values.size() - 2);
+  }
+
+  for (const std::string& value : split(values, ','))
+  {
+    // integer ranges "start:end[:stride]"
+    const std::vector<std::string> range = split(value, ':');
+    if (range.size() == 2 || range.size() == 3)
+    {
+      const long long start  = std::stoll(range[0]);
+      const long long end    = std::stoll(range[1]);
+      const long long stride = range.size() == 3 ? std::stoll(range[2]) : 1;
+      for (long long i = start; i <= end; i += stride)
+      {
+        result.values.push_back(std::to_string(i));
+      }
+    }
+    else
+    {
+      result.values.push_back(value);
+    }
+  }
+
+  return result;
+}
+
+void apply_override(nvbench::axis& a, const axis_override& o)
+{
+  nvbench::axis result{a.name, a.flags, a.type, {}, {}, {}, {}};
+
+  for (const std::string& value : o.values)
+  {
+    switch (a.type)
+    {
+      case nvbench::axis_type::type:
+      case nvbench::axis_type::string: {
+        auto iter = std::find(a.input_strings.begin(), a.input_strings.end(), value);
+        if (iter == a.input_strings.end())
+        {
+          throw std::runtime_error("axis " + a.name + " has no value " + value);
+        }
+        const std::size_t i = iter - a.input_strings.begin();
+        result.input_strings.push_back(a.input_strings[i]);
+        result.descriptions.push_back(a.descriptions[i]);
+        break;
+      }
+      case nvbench::axis_type::int64: {
+        const long long parsed = std::stoll(value);
+        const bool pow2        = o.flags == "pow2" || (o.flags.empty() && a.flags == "pow2");
+        const long long v      = pow2 ? (1ll << parsed) : parsed;
+        result.input_strings.push_back(a.flags == "pow2" ? std::to_string(pow2 ? parsed : std::llround(std::log2(v)))
+                                                         : std::to_string(v));
+        result.descriptions.push_back(a.flags == "pow2" ? "2^" + result.input_strings.back() + " = " + std::to_string(v)
+                                                        : "");
+        result.int64_values.push_back(v);
+        break;
+      }
+      case nvbench::axis_type::float64: {
+        const double v = std::stod(value);
+        result.input_strings.push_back(nvbench::benchmark_base::format_float64(v));
+        result.descriptions.push_back("");
+        result.float64_values.push_back(v);
+        break;
+      }
+    }
+  }
+
+  a = std::move(result);
+}
+
+std::vector<nvbench::axis> benchmark_axes(const nvbench::benchmark_base& bench)
+{
+  std::vector<nvbench::axis> axes = bench.get_axes();
+
+  if (has_thread_axis)
+  {
+    nvbench::axis threads{threads_axis_name, "", nvbench::axis_type::int64, {}, {}, {}, {}};
+    for (int t = 1; t < hardware_threads(); t *= 2)
+    {
+      threads.input_strings.push_back(std::to_string(t));
+      threads.descriptions.push_back("");
+      threads.int64_values.push_back(t);
+    }
+    threads.input_strings.push_back(std::to_string(hardware_threads()));
+    threads.descriptions.push_back("");
+    threads.int64_values.push_back(hardware_threads());
+    axes.push_back(std::move(threads));
+  }
+
+  return axes;
+}
+
+std::vector<nvbench::axis>
+selected_axes(const nvbench::benchmark_base& bench, int index, const std::vector<axis_override>& overrides)
+{
+  std::vector<nvbench::axis> axes = benchmark_axes(bench);
+
+  for (const axis_override& o : overrides)
+  {
+    if (o.benchmark != -1 && o.benchmark != index)
+    {
+      continue;
+    }
+
+    auto iter = std::find_if(axes.begin(), axes.end(), [&](const nvbench::axis& a) {
+      return a.name == o.name;
+    });
+
+    if (iter == axes.end())
+    {
+      throw std::runtime_error("benchmark " + bench.get_name() + " has no axis " + o.name);
+    }
+
+    apply_override(*iter, o);
+  }
+
+  return axes;
+}
+
+// Running
+
+struct options
+{
+  nvbench::run_criteria criteria;
+  std::vector<int> benchmarks;
+  std::vector<axis_override> overrides;
+  std::string json_path;
+};
+
+struct axis_value
+{
+  std::string name;
+  nvbench::axis_type type;
+  std::string value;
+};
+
+struct state_result
+{
+  std::string name;
+  std::vector<axis_value> axis_values;
+  std::size_t type_config;
+  bool skipped;
+  std::string skip_reason;
+  std::vector<double> samples;
+  std::size_t elements;
+  std::size_t bytes;
+};
+
+double mean(const std::vector<double>& samples)
+{
+  return samples.empty() ? 0.0 : std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+}
+
+double relative_stdev(const std::vector<double>& samples)
+{
+  if (samples.size() < 2)
+  {
+    return 0.0;
+  }
+
+  const double m = mean(samples);
+  double sum     = 0.0;
+  for (double s : samples)
+  {
+    sum += (s - m) * (s - m);
+  }
+
+  return m > 0.0 ? std::sqrt(sum / (samples.size() - 1)) / m : 0.0;
+}
+
+std::string format_time(double seconds)
+{
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(3);
+
+  if (seconds >= 1.0)
+  {
+    out << seconds << " s";
+  }
+  else if (seconds >= 1e-3)
+  {
+    out << seconds * 1e3 << " ms";
+  }
+  else
+  {
+    out << seconds * 1e6 << " us";
+  }
+
+  return out.str();
+}
+
+std::string format_rate(double value, const char* unit)
+{
+  const char* prefixes[] = {"", "K", "M", "G", "T"};
+  int prefix             = 0;
+
+  while (value >= 1000.0 && prefix < 4)
+  {
+    value /= 1000.0;
+    ++prefix;
+  }
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(3);
+  out << value << prefixes[prefix] << unit;
+  return out.str();
+}
+
+std::vector<state_result> run_benchmark(const nvbench::benchmark_base& bench, int index, const options& opts)
+{
+  const std::vector<nvbench::axis> all_axes = bench.get_axes();
+  const std::vector<nvbench::axis> axes     = selected_axes(bench, index, opts.overrides);
+
+  std::vector<state_result> results;
+
+  std::cout << "# " << bench.get_name() << "\n\n|";
+  for (const nvbench::axis& a : axes)
+  {
+    std::cout << ' ' << a.name << " |";
+  }
+  std::cout << " Samples | CPU Time | Noise | Elem/s | Bandwidth |\n" << std::flush;
+
+  for (const nvbench::axis& a : axes)
+  {
+    if (a.input_strings.empty())
+    {
+      return results;
+    }
+  }
+
+  std::vector<std::size_t> point(axes.size(), 0);
+
+  while (true)
+  {
+    nvbench::state s(bench, opts.criteria);
+    state_result result{"Device=0", {}, 0, false, "", {}, 0, 0};
+    int num_threads = hardware_threads();
+
+    for (std::size_t i = 0; i < axes.size(); ++i)
+    {
+      const nvbench::axis& a = axes[i];
+      const std::size_t v    = point[i];
+
+      result.axis_values.push_back(
+        {a.name, a.type, a.type == nvbench::axis_type::int64 ? std::to_string(a.int64_values[v]) : a.input_strings[v]});
+      result.name += " " + a.name + "=" + a.input_strings[v];
+
+      switch (a.type)
+      {
+        case nvbench::axis_type::type: {
+          // position of the value among all of the axis' values
+          const std::vector<std::string>& strings = all_axes[i].input_strings;
+          const std::size_t j = std::find(strings.begin(), strings.end(), a.input_strings[v]) - strings.begin();
+          result.type_config  = result.type_config * strings.size() + j;
+          break;
+        }
+        case nvbench::axis_type::int64:
+          if (a.name == threads_axis_name && has_thread_axis && i == axes.size() - 1)
+          {
+            num_threads = static_cast<int>(a.int64_values[v]);
+          }
+          s.set_int64(a.name, a.int64_values[v]);
+          break;
+        case nvbench::axis_type::float64:
+          s.set_float64(a.name, a.float64_values[v]);
+          break;
+        case nvbench::axis_type::string:
+          s.set_string(a.name, a.input_strings[v]);
+          break;
+      }
+    }
+
+    {
+      thread_limit limit(num_threads);
+      bench.run(result.type_config, s);
+    }
+
+    result.skipped     = s.is_skipped();
+    result.skip_reason = s.get_skip_reason();
+    result.samples     = s.get_samples();
+    result.elements    = s.get_element_count();
+    result.bytes       = s.get_global_memory_bytes();
+
+    std::cout << '|';
+    for (std::size_t i = 0; i < axes.size(); ++i)
+    {
+      std::cout << ' ' << axes[i].input_strings[point[i]] << " |";
+    }
+
+    if (result.skipped)
+    {
+      std::cout << " skipped: " << result.skip_reason << " |\n";
+    }
+    else
+    {
+      const double time = mean(result.samples);
+      std::cout << ' ' << result.samples.size() << "x | " << format_time(time) << " | " << std::fixed
+                << std::setprecision(2) << relative_stdev(result.samples) * 100 << "% | "
+                << format_rate(time > 0 ? result.elements / time : 0, "") << " | "
+                << format_rate(time > 0 ? result.bytes / time : 0, "B/s") << " |\n";
+      std::cout.unsetf(std::ios::fixed);
+    }
+    std::cout << std::flush;
+
+    results.push_back(std::move(result));
+
+    // advance to the next point, the last axis varying fastest
+    std::size_t i = axes.size();
+    while (i > 0)
+    {
+      --i;
+      if (++point[i] < axes[i].input_strings.size())
+      {
+        break;
+      }
+      point[i] = 0;
+      if (i == 0)
+      {
+        i = axes.size() + 1;
+        break;
+      }
+    }
+
+    if (axes.empty() || i == axes.size() + 1)
+    {
+      break;
+    }
+  }
+
+  std::cout << '\n';
+
+  return results;
+}
+
+std::string state_json(const state_result& result, const std::string& bin_dir, int bin_index)
+{
+  std::ostringstream out;
+
+  out << "{\"name\": " << quote(result.name) << ", \"device\": 0, \"type_config_index\": " << result.type_config
+      << ", \"axis_values\": " << json_array(result.axis_values, [](const axis_value& v) {
+           return "{\"name\": " + quote(v.name) + ", \"type\": " + quote(axis_type_name(v.type))
+                + ", \"value\": " + quote(v.value) + "}";
+         });
+
+  std::vector<std::string> summaries;
+
+  if (!result.skipped)
+  {
+    const double time = mean(result.samples);
+
+    summaries.push_back(summary_json("nv/cold/sample_size", "Samples", "int64", std::to_string(result.samples.size())));
+    summaries.push_back(summary_json("nv/cold/time/cpu/mean", "CPU Time", "float64", to_string(time)));
+    summaries.push_back(summary_json(
+      "nv/cold/time/cpu/stdev/relative", "Noise", "float64", to_string(relative_stdev(result.samples))));
+
+    if (time > 0 && result.elements > 0)
+    {
+      summaries.push_back(summary_json("nv/element_count", "Elem/s", "float64", to_string(result.elements / time)));
+    }
+
+    if (time > 0 && result.bytes > 0)
+    {
+      summaries.push_back(
+        summary_json("nv/cold/bw/global/bytes_per_second", "Bandwidth", "float64", to_string(result.bytes / time)));
+    }
+
+    if (!bin_dir.empty())
+    {
+      const std::string filename = bin_dir + "/" + std::to_string(bin_index) + ".bin";
+      std::vector<float> samples(result.samples.begin(), result.samples.end());
+      std::ofstream bin(filename, std::ios::binary);
+      bin.write(reinterpret_cast<const char*>(samples.data()), samples.size() * sizeof(float));
+
+      summaries.push_back(
+        "{\"tag\": \"nv/json/bin:nv/cold/sample_times\", \"name\": \"Samples Times File\", \"data\": [{\"name\": "
+        "\"filename\", \"type\": \"string\", \"value\": "
+        + quote(filename) + "}, {\"name\": \"size\", \"type\": \"int64\", \"value\": \""
+        + std::to_string(samples.size()) + "\"}]}");
+    }
+  }
+
+  out << ", \"summaries\": " << json_array(summaries, [](const std::string& s) {
+    return s;
+  }) << ", \"is_skipped\": "
+      << (result.skipped ? "true" : "false") << ", \"skip_reason\": " << quote(result.skip_reason) << "}";
+
+  return out.str();
+}
+
+int find_benchmark(const std::string& name_or_index)
+{
+  const auto& benches = nvbench::benchmark_manager::get().get_benchmarks();
+
+  for (std::size_t i = 0; i < benches.size(); ++i)
+  {
+    if (benches[i]->get_name() == name_or_index)
+    {
+      return static_cast<int>(i);
+    }
+  }
+
+  const int index = std::stoi(name_or_index);
+  if (index < 0 || index >= static_cast<int>(benches.size()))
+  {
+    throw std::runtime_error("no benchmark " + name_or_index);
+  }
+
+  return index;
+}
+
+void list_benchmarks(bool json)
+{
+  const auto& benches = nvbench::benchmark_manager::get().get_benchmarks();
+
+  if (json)
+  {
+    std::vector<int> indices(benches.size());
+    std::iota(indices.begin(), indices.end(), 0);
+
+    std::cout << "{\"benchmarks\": " << json_array(indices, [&](int i) {
+      const std::vector<nvbench::axis> axes = benchmark_axes(*benches[i]);
+      return "{\"name\": " + quote(benches[i]->get_name()) + ", \"index\": " + std::to_string(i)
+           + ", \"axes\": " + json_array(axes, axis_json) + "}";
+    }) << "}\n";
+    return;
+  }
+
+  for (std::size_t i = 0; i < benches.size(); ++i)
+  {
+    std::cout << i << ": " << benches[i]->get_name() << '\n';
+    for (const nvbench::axis& a : benchmark_axes(*benches[i]))
+    {
+      std::cout << "  " << a.name << (a.flags.empty() ? "" : "[" + a.flags + "]") << " (" << axis_type_name(a.type)
+                << "): ";
+      for (std::size_t v = 0; v < a.input_strings.size(); ++v)
+      {
+        std::cout << (v ? ", " : "") << a.input_strings[v];
+      }
+      std::cout << '\n';
+    }
+  }
+}
+
+int run(int argc, char** argv)
+{
+  options opts;
+  int current_benchmark = -1;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+
+    auto next = [&]() -> std::string {
+      if (i + 1 >= argc)
+      {
+        throw std::runtime_error("missing value for " + arg);
+      }
+      return argv[++i];
+    };
+
+    if (arg == "--list" || arg == "-l")
+    {
+      list_benchmarks(false);
+      return 0;
+    }
+    else if (arg == "--jsonlist-benches")
+    {
+      list_benchmarks(true);
+      return 0;
+    }
+    else if (arg == "--jsonlist-devices")
+    {
+      std::cout << "{\"devices\": [" << device_json() << "]}\n";
+      return 0;
+    }
+    else if (arg == "--benchmark" || arg == "-b")
+    {
+      current_benchmark = find_benchmark(next());
+      opts.benchmarks.push_back(current_benchmark);
+    }
+    else if (arg == "--axis" || arg == "-a")
+    {
+      opts.overrides.push_back(parse_axis_override(current_benchmark, next()));
+    }
+    else if (arg == "--json" || arg == "--jsonbin")
+    {
+      opts.json_path = next();
+    }
+    else if (arg == "--min-samples")
+    {
+      opts.criteria.min_samples = std::stoll(next());
+    }
+    else if (arg == "--min-time")
+    {
+      opts.criteria.min_time = std::stod(next());
+    }
+    else if (arg == "--timeout")
+    {
+      opts.criteria.timeout = std::stod(next());
+    }
+    else if (arg == "--device" || arg == "-d" || arg == "--devices" || arg == "--stopping-criterion")
+    {
+      next();
+    }
+    else
+    {
+      throw std::runtime_error("unknown argument " + arg);
+    }
+  }
+
+  const auto& benches = nvbench::benchmark_manager::get().get_benchmarks();
+
+  if (opts.benchmarks.empty())
+  {
+    opts.benchmarks.resize(benches.size());
+    std::iota(opts.benchmarks.begin(), opts.benchmarks.end(), 0);
+  }
+
+  std::string bin_dir;
+  if (!opts.json_path.empty())
+  {
+    bin_dir = opts.json_path + "-bin";
+    std::filesystem::create_directories(bin_dir);
+  }
+
+  std::vector<std::string> benchmarks_json;
+  int bin_index = 0;
+
+  for (int index : opts.benchmarks)
+  {
+    const nvbench::benchmark_base& bench = *benches[index];
+    const std::vector<state_result> results = run_benchmark(bench, index, opts);
+
+    std::vector<std::string> states;
+    for (const state_result& result : results)
+    {
+      states.push_back(state_json(result, bin_dir, bin_index++));
+    }
+
+    const std::vector<nvbench::axis> axes = selected_axes(bench, index, opts.overrides);
+    std::ostringstream out;
+    out << "{\"name\": " << quote(bench.get_name()) << ", \"index\": " << index
+        << ", \"min_samples\": " << opts.criteria.min_samples << ", \"min_time\": " << opts.criteria.min_time
+        << ", \"timeout\": " << opts.criteria.timeout << ", \"devices\": [0], \"axes\": " << json_array(axes, axis_json)
+        << ", \"states\": " << json_array(states, [](const std::string& s) {
+             return s;
+           })
+        << "}";
+    benchmarks_json.push_back(out.str());
+  }
+
+  if (!opts.json_path.empty())
+  {
+    std::vector<std::string> args(argv, argv + argc);
+    std::ofstream json(opts.json_path);
+    json << "{\"meta\": {\"argv\": " << json_array(args, quote) << "}, \"devices\": [" << device_json()
+         << "], \"benchmarks\": " << json_array(benchmarks_json, [](const std::string& s) {
+              return s;
+            })
+         << "}\n";
+  }
+
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  try
+  {
+    return run(argc, argv);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "error: " << e.what() << '\n';
+    return 1;
+  }
+}
@@ -0,0 +1,634 @@
+// SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// A host-only stand-in for the subset of NVBench used by thrust/benchmarks.
+//
+// The CPP, OMP and TBB configurations of the benchmarks are built against
+// this header instead of NVBench, which requires CUDA. Benchmarks are written
+// exactly as for NVBench; the runner in main.cpp sweeps their axes, times
+// state::exec on the host and emits NVBench-compatible JSON, so the results
+// can be consumed by benchmarks/scripts.
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#if THRUST_DEVICE_COMPILER != THRUST_DEVICE_COMPILER_NVCC
+#  ifndef __host__
+#    define __host__
+#  endif
+#  ifndef __device__
+#    define __device__
+#  endif
+#  ifndef __forceinline__
+#    define __forceinline__ inline
+#  endif
+#endif
+
+namespace nvbench
+{
+
+using int8_t    = std::int8_t;
+using int16_t   = std::int16_t;
+using int32_t   = std::int32_t;
+using int64_t   = std::int64_t;
+using uint8_t   = std::uint8_t;
+using uint16_t  = std::uint16_t;
+using uint32_t  = std::uint32_t;
+using uint64_t  = std::uint64_t;
+using float32_t = float;
+using float64_t = double;
+
+template <typename... Ts>
+struct type_list
+{};
+
+// The inclusive range [start, end] with the given stride.
+inline std::vector<int64_t> range(int64_t start, int64_t end, int64_t stride = 1)
+{
+  std::vector<int64_t> result;
+
+  for (int64_t i = start; i <= end; i += stride)
+  {
+    result.push_back(i);
+  }
+
+  return result;
+}
+
+template <typename T>
+struct type_strings
+{
+  static std::string input_string()
+  {
+    return typeid(T).name();
+  }
+
+  static std::string description()
+  {
+    return typeid(T).name();
+  }
+};
+
+} // namespace nvbench
+
+#define NVBENCH_DECLARE_TYPE_STRINGS(Type, InputString, Description) \
+  namespace nvbench                                                  \
+  {                                                                  \
+  template <>                                                        \
+  struct type_strings<Type>                                          \
+  {                                                                  \
+    static std::string input_string()                                \
+    {                                                                \
+      return InputString;                                            \
+    }                                                                \
+    static std::string description()                                 \
+    {                                                                \
+      return Description;                                            \
+    }                                                                \
+  };                                                                 \
+  }
+
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int8_t, "I8", "int8_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int16_t, "I16", "int16_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int32_t, "I32", "int32_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int64_t, "I64", "int64_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint8_t, "U8", "uint8_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint16_t, "U16", "uint16_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint32_t, "U32", "uint32_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint64_t, "U64", "uint64_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float32_t, "F32", "float");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float64_t, "F64", "double");
+NVBENCH_DECLARE_TYPE_STRINGS(bool, "B8", "bool");
+
+namespace nvbench
+{
+
+enum class axis_type
+{
+  type,
+  int64,
+  float64,
+  string
+};
+
+// A benchmark parameter and the values it is swept over. Values are kept both
+// as the strings they are given and printed with, and in their typed form.
+struct axis
+{
+  std::string name;
+  std::string flags; // "pow2" for axes given as exponents of two
+  axis_type type;
+  std::vector<std::string> input_strings;
+  std::vector<std::string> descriptions;
+  std::vector<int64_t> int64_values;
+  std::vector<double> float64_values;
+};
+
+namespace exec_tag
+{
+
+// The tags only describe how NVBench launches and synchronizes CUDA work; on
+// the host every sample is synchronous, and whether the benchmark times
+// itself is deduced from the signature of the function passed to exec.
+struct tag
+{
+  unsigned flags;
+};
+
+constexpr tag operator|(tag lhs, tag rhs)
+{
+  return tag{lhs.flags | rhs.flags};
+}
+
+constexpr tag none{0};
+constexpr tag timer{1};
+constexpr tag sync{2};
+constexpr tag no_batch{4};
+
+} // namespace exec_tag
+
+struct launch
+{};
+
+// Accumulates the time between start() and stop() for benchmarks that exclude
+// their per-sample setup from the measurement.
+class timer
+{
+public:
+  void start()
+  {
+    m_start = std::chrono::steady_clock::now();
+  }
+
+  void stop()
+  {
+    m_elapsed += std::chrono::steady_clock::now() - m_start;
+  }
+
+  double seconds() const
+  {
+    return std::chrono::duration<double>(m_elapsed).count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point m_start{};
+  std::chrono::steady_clock::duration m_elapsed{};
+};
+
+// When to stop collecting samples of a state.
+struct run_criteria
+{
+  int64_t min_samples = 10;
+  double min_time     = 0.5;
+  double timeout      = 15.0;
+};
+
+class benchmark_base;
+
+// One point of a benchmark's parameter space, and the samples measured there.
+class state
+{
+public:
+  state(const benchmark_base& bench, const run_criteria& criteria)
+      : m_bench(bench)
+      , m_criteria(criteria)
+  {}
+
+  const benchmark_base& get_benchmark() const
+  {
+    return m_bench;
+  }
+
+  int64_t get_int64(const std::string& name) const
+  {
+    return find(m_int64_values, name);
+  }
+
+  double get_float64(const std::string& name) const
+  {
+    return find(m_float64_values, name);
+  }
+
+  const std::string& get_string(const std::string& name) const
+  {
+    return find(m_string_values, name);
+  }
+
+  void set_int64(const std::string& name, int64_t value)
+  {
+    m_int64_values[name] = value;
+  }
+
+  void set_float64(const std::string& name, double value)
+  {
+    m_float64_values[name] = value;
+  }
+
+  void set_string(const std::string& name, std::string value)
+  {
+    m_string_values[name] = std::move(value);
+  }
+
+  void add_element_count(std::size_t elements, const std::string& = {})
+  {
+    m_element_count += elements;
+  }
+
+  template <typename T>
+  void add_global_memory_reads(std::size_t count, const std::string& = {})
+  {
+    m_bytes += count * sizeof(T);
+  }
+
+  template <typename T>
+  void add_global_memory_writes(std::size_t count, const std::string& = {})
+  {
+    m_bytes += count * sizeof(T);
+  }
+
+  void skip(std::string reason)
+  {
+    m_skip_reason = std::move(reason);
+  }
+
+  bool is_skipped() const
+  {
+    return !m_skip_reason.empty();
+  }
+
+  const std::string& get_skip_reason() const
+  {
+    return m_skip_reason;
+  }
+
+  std::size_t get_element_count() const
+  {
+    return m_element_count;
+  }
+
+  std::size_t get_global_memory_bytes() const
+  {
+    return m_bytes;
+  }
+
+  // The duration of every sample, in seconds.
+  const std::vector<double>& get_samples() const
+  {
+    return m_samples;
+  }
+
+  template <typename KernelLauncher>
+  void exec(exec_tag::tag, KernelLauncher&& launcher)
+  {
+    if (is_skipped())
+    {
+      return;
+    }
+
+    launch l;
+
+    // warm up caches, the allocator and the thread pool
+    run_once(launcher, l);
+
+    const auto begin = std::chrono::steady_clock::now();
+    double measured  = 0.0;
+
+    while (true)
+    {
+      const double sample = run_once(launcher, l);
+
+      m_samples.push_back(sample);
+      measured += sample;
+
+      if (static_cast<int64_t>(m_samples.size()) >= m_criteria.min_samples && measured >= m_criteria.min_time)
+      {
+        break;
+      }
+
+      if (std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() >= m_criteria.timeout)
+      {
+        break;
+      }
+    }
+  }
+
+private:
+  template <typename KernelLauncher>
+  static double run_once(KernelLauncher& launcher, launch& l)
+  {
+    if constexpr (std::is_invocable_v<KernelLauncher&, launch&, nvbench::timer&>)
+    {
+      nvbench::timer t;
+      launcher(l, t);
+      return t.seconds();
+    }
+    else
+    {
+      const auto begin = std::chrono::steady_clock::now();
+      launcher(l);
+      return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+  }
+
+  template <typename Map>
+  static const typename Map::mapped_type& find(const Map& values, const std::string& name)
+  {
+    auto iter = values.find(name);
+
+    if (iter == values.end())
+    {
+      throw std::runtime_error("no axis named " + name);
+    }
+
+    return iter->second;
+  }
+
+  const benchmark_base& m_bench;
+  run_criteria m_criteria;
+  std::map<std::string, int64_t> m_int64_values;
+  std::map<std::string, double> m_float64_values;
+  std::map<std::string, std::string> m_string_values;
+  std::size_t m_element_count = 0;
+  std::size_t m_bytes         = 0;
+  std::string m_skip_reason;
+  std::vector<double> m_samples;
+};
+
+class benchmark_base
+{
+public:
+  virtual ~benchmark_base() = default;
+
+  const std::string& get_name() const
+  {
+    return m_name;
+  }
+
+  const std::vector<axis>& get_axes() const
+  {
+    return m_axes;
+  }
+
+  benchmark_base& set_name(std::string name)
+  {
+    m_name = std::move(name);
+    return *this;
+  }
+
+  benchmark_base& set_type_axes_names(std::vector<std::string> names)
+  {
+    for (std::size_t i = 0; i < names.size() && i < m_axes.size(); ++i)
+    {
+      if (m_axes[i].type == axis_type::type)
+      {
+        m_axes[i].name = std::move(names[i]);
+      }
+    }
+    return *this;
+  }
+
+  benchmark_base& add_int64_axis(std::string name, std::vector<int64_t> values)
+  {
+    axis a{std::move(name), "", axis_type::int64, {}, {}, {}, {}};
+    for (int64_t value : values)
+    {
+      a.input_strings.push_back(std::to_string(value));
+      a.descriptions.push_back("");
+      a.int64_values.push_back(value);
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  benchmark_base& add_int64_power_of_two_axis(std::string name, std::vector<int64_t> exponents)
+  {
+    axis a{std::move(name), "pow2", axis_type::int64, {}, {}, {}, {}};
+    for (int64_t exponent : exponents)
+    {
+      const int64_t value = int64_t{1} << exponent;
+      a.input_strings.push_back(std::to_string(exponent));
+      a.descriptions.push_back("2^" + std::to_string(exponent) + " = " + std::to_string(value));
+      a.int64_values.push_back(value);
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  benchmark_base& add_float64_axis(std::string name, std::vector<double> values)
+  {
+    axis a{std::move(name), "", axis_type::float64, {}, {}, {}, {}};
+    for (double value : values)
+    {
+      a.input_strings.push_back(format_float64(value));
+      a.descriptions.push_back("");
+      a.float64_values.push_back(value);
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  benchmark_base& add_string_axis(std::string name, std::vector<std::string> values)
+  {
+    axis a{std::move(name), "", axis_type::string, {}, {}, {}, {}};
+    for (std::string& value : values)
+    {
+      a.input_strings.push_back(value);
+      a.descriptions.push_back("");
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  // The benchmark is instantiated once per combination of the values of its
+  // type axes; type_config enumerates those combinations, with the first
+  // type axis varying slowest.
+  virtual void run(std::size_t type_config, state& s) const = 0;
+
+  static std::string format_float64(double value)
+  {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%g", value);
+    return buffer;
+  }
+
+protected:
+  std::string m_name;
+  std::vector<axis> m_axes;
+};
+
+namespace detail
+{
+
+template <typename... Lists>
+struct concat;
+
+template <>
+struct concat<>
+{
+  using type = type_list<>;
+};
+
+template <typename... Ts>
+struct concat<type_list<Ts...>>
+{
+  using type = type_list<Ts...>;
+};
+
+template <typename... Ts, typename... Us, typename... Rest>
+struct concat<type_list<Ts...>, type_list<Us...>, Rest...>
+{
+  using type = typename concat<type_list<Ts..., Us...>, Rest...>::type;
+};
+
+// The cartesian product of the type axes, as a type_list of type_lists.
+template <typename Chosen, typename... Axes>
+struct product;
+
+template <typename... Chosen>
+struct product<type_list<Chosen...>>
+{
+  using type = type_list<type_list<Chosen...>>;
+};
+
+template <typename... Chosen, typename... Heads, typename... Axes>
+struct product<type_list<Chosen...>, type_list<Heads...>, Axes...>
+{
+  using type = typename concat<typename product<type_list<Chosen..., Heads>, Axes...>::type...>::type;
+};
+
+template <typename TypeAxes>
+struct type_configs;
+
+template <typename... Axes>
+struct type_configs<type_list<Axes...>>
+{
+  using type = typename product<type_list<>, Axes...>::type;
+};
+
+template <typename Generator, typename Configs>
+struct dispatcher;
+
+template <typename Generator, typename... Configs>
+struct dispatcher<Generator, type_list<Configs...>>
+{
+  static void run(std::size_t type_config, state& s)
+  {
+    using function_t            = void (*)(state&);
+    static const function_t f[] = {&invoke<Configs>...};
+    f[type_config](s);
+  }
+
+  template <typename Config>
+  static void invoke(state& s)
+  {
+    Generator{}(s, Config{});
+  }
+};
+
+template <typename... Ts>
+void add_type_axis(std::vector<axis>& axes, type_list<Ts...>)
+{
+  axes.push_back(axis{"T" + std::to_string(axes.size()),
+                      "",
+                      axis_type::type,
+                      {type_strings<Ts>::input_string()...},
+                      {type_strings<Ts>::description()...},
+                      {},
+                      {}});
+}
+
+template <typename... Axes>
+void add_type_axes(std::vector<axis>& axes, type_list<Axes...>)
+{
+  (add_type_axis(axes, Axes{}), ...);
+}
+
+} // namespace detail
+
+template <typename Generator, typename TypeAxes>
+class benchmark : public benchmark_base
+{
+public:
+  benchmark()
+  {
+    detail::add_type_axes(m_axes, TypeAxes{});
+  }
+
+  void run(std::size_t type_config, state& s) const override
+  {
+    detail::dispatcher<Generator, typename detail::type_configs<TypeAxes>::type>::run(type_config, s);
+  }
+};
+
+class benchmark_manager
+{
+public:
+  static benchmark_manager& get()
+  {
+    static benchmark_manager manager;
+    return manager;
+  }
+
+  benchmark_base& add(std::unique_ptr<benchmark_base> bench)
+  {
+    m_benchmarks.push_back(std::move(bench));
+    return *m_benchmarks.back();
+  }
+
+  const std::vector<std::unique_ptr<benchmark_base>>& get_benchmarks() const
+  {
+    return m_benchmarks;
+  }
+
+private:
+  std::vector<std::unique_ptr<benchmark_base>> m_benchmarks;
+};
+
+} // namespace nvbench
+
+#define NVBENCH_TYPE_AXES(...) nvbench::type_list<__VA_ARGS__>
+
+#define NVBENCH_DETAIL_CONCAT_IMPL(a, b) a##b
+#define NVBENCH_DETAIL_CONCAT(a, b)      NVBENCH_DETAIL_CONCAT_IMPL(a, b)
+#define NVBENCH_DETAIL_UNIQUE(base)      NVBENCH_DETAIL_CONCAT(base, __LINE__)
+
+#define NVBENCH_BENCH_TYPES(KernelGenerator, TypeAxes)                                                        \
+  struct NVBENCH_DETAIL_UNIQUE(KernelGenerator##_callable)                                                    \
+  {                                                                                                           \
+    template <typename... Ts>                                                                                 \
+    void operator()(nvbench::state& s, nvbench::type_list<Ts...> types) const                                 \
+    {                                                                                                         \
+      KernelGenerator(s, types);                                                                              \
+    }                                                                                                         \
+  };                                                                                                          \
+  static nvbench::benchmark_base& NVBENCH_DETAIL_UNIQUE(KernelGenerator##_benchmark) =                        \
+    nvbench::benchmark_manager::get().add(                                                                    \
+      std::make_unique<nvbench::benchmark<NVBENCH_DETAIL_UNIQUE(KernelGenerator##_callable), TypeAxes>>())   \
+      .set_name(#KernelGenerator)
+
+#define NVBENCH_BENCH(KernelGenerator)                                                                                 \
+  struct NVBENCH_DETAIL_UNIQUE(KernelGenerator##_callable)                                                             \
+  {                                                                                                                    \
+    void operator()(nvbench::state& s, nvbench::type_list<>) const                                                     \
+    {                                                                                                                  \
+      KernelGenerator(s);                                                                                              \
+    }                                                                                                                  \
+  };                                                                                                                   \
+  static nvbench::benchmark_base& NVBENCH_DETAIL_UNIQUE(KernelGenerator##_benchmark) =                                 \
+    nvbench::benchmark_manager::get().add(                                                                             \
+      std::make_unique<nvbench::benchmark<NVBENCH_DETAIL_UNIQUE(KernelGenerator##_callable), nvbench::type_list<>>>()) \
+      .set_name(#KernelGenerator)
@@ -1,5 +1,6 @@
 #include <thrust/binary_search.h>
 #include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/fill.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/sequence.h>
@@ -267,6 +268,33 @@ void TestVectorBinarySearchSimple()
 }
 DECLARE_VECTOR_UNITTEST(TestVectorBinarySearchSimple);
 
+template <class Vector>
+void TestVectorSearchEmptyHaystack()
+{
+  Vector vec;
+
+  Vector input(100);
+  thrust::sequence(input.begin(), input.end());
+
+  using int_type   = typename Vector::difference_type;
+  using IntVector  = typename vector_like<Vector, int_type>::type;
+  using BoolVector = typename vector_like<Vector, bool>::type;
+
+  IntVector integral_output(100, 1);
+  BoolVector bool_output(100, true);
+
+  thrust::lower_bound(vec.begin(), vec.end(), input.begin(), input.end(), integral_output.begin());
+  ASSERT_EQUAL(integral_output, IntVector(100, 0));
+
+  thrust::fill(integral_output.begin(), integral_output.end(), 1);
+  thrust::upper_bound(vec.begin(), vec.end(), input.begin(), input.end(), integral_output.begin());
+  ASSERT_EQUAL(integral_output, IntVector(100, 0));
+
+  thrust::binary_search(vec.begin(), vec.end(), input.begin(), input.end(), bool_output.begin());
+  ASSERT_EQUAL(bool_output, BoolVector(100, false));
+}
+DECLARE_VECTOR_UNITTEST(TestVectorSearchEmptyHaystack);
+
 template <typename ForwardIterator, typename InputIterator, typename OutputIterator>
 OutputIterator
 binary_search(my_system& system, ForwardIterator, ForwardIterator, InputIterator, InputIterator, OutputIterator output)
@@ -0,0 +1,98 @@
+// Route the temporary allocations of the host systems through a thread-local cache.
+#define THRUST_CACHE_HOST_TEMPORARY_ALLOCATIONS
+
+#include <thrust/copy.h>
+#include <thrust/detail/host_caching_resource.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <unittest/unittest.h>
+
+struct is_odd
+{
+  _CCCL_HOST_DEVICE bool operator()(int x) const
+  {
+    return x % 2 != 0;
+  }
+};
+
+void run_host_algorithms(std::size_t n)
+{
+  thrust::host_vector<int> keys(n);
+  thrust::sequence(keys.begin(), keys.end());
+  thrust::host_vector<int> values = keys;
+
+  thrust::sort(keys.begin(), keys.end(), thrust::greater<int>());
+  thrust::stable_sort_by_key(keys.begin(), keys.end(), values.begin());
+
+  thrust::host_vector<int> odd(n);
+  thrust::copy_if(keys.begin(), keys.end(), odd.begin(), is_odd());
+
+  thrust::host_vector<int> unique_keys(n);
+  thrust::host_vector<int> sums(n);
+  thrust::reduce_by_key(keys.begin(), keys.end(), values.begin(), unique_keys.begin(), sums.begin());
+
+  ASSERT_EQUAL(keys[0], 0);
+  ASSERT_EQUAL(values[0], static_cast<int>(n - 1));
+}
+
+void TestCacheHostTemporaryAllocations()
+{
+  const std::size_t n = 10000;
+  auto& resource = thrust::detail::host_tls_caching_resource();
+
+  run_host_algorithms(n);
+  const thrust::mr::pool_statistics first = resource.get_stats();
+
+  run_host_algorithms(n);
+  run_host_algorithms(n);
+  const thrust::mr::pool_statistics later = resource.get_stats();
+
+  // the algorithms need temporary storage, so the resource is used at all
+  ASSERT_LESS(first.allocations, later.allocations);
+  // but after the first round, all of it is already cached
+  ASSERT_EQUAL(later.upstream_allocations, first.upstream_allocations);
+  ASSERT_EQUAL(later.bytes_in_use, 0u);
+}
+DECLARE_UNITTEST(TestCacheHostTemporaryAllocations);
+
+void TestHostCachingResourceMaxBytesCached()
+{
+  thrust::detail::host_caching_resource resource(4096);
+  ASSERT_EQUAL(resource.max_bytes_cached(), 4096u);
+
+  void* small[4];
+  for (void*& p : small)
+  {
+    p = resource.do_allocate(1024);
+  }
+  void* large = resource.do_allocate(8192);
+
+  for (void* p : small)
+  {
+    resource.do_deallocate(p, 1024);
+  }
+  // freeing the large block would take the cache past its limit, so it goes back upstream
+  resource.do_deallocate(large, 8192);
+
+  thrust::mr::pool_statistics stats = resource.get_stats();
+  ASSERT_EQUAL(stats.bytes_cached, 4096u);
+  ASSERT_EQUAL(stats.bytes_upstream, 4096u);
+  ASSERT_EQUAL(stats.upstream_deallocations, 1u);
+
+  // lowering the limit trims the cache
+  resource.set_max_bytes_cached(2048);
+  stats = resource.get_stats();
+  ASSERT_EQUAL(stats.bytes_cached, 2048u);
+  ASSERT_EQUAL(stats.bytes_upstream, 2048u);
+
+  resource.release();
+  stats = resource.get_stats();
+  ASSERT_EQUAL(stats.bytes_cached, 0u);
+  ASSERT_EQUAL(stats.bytes_upstream, 0u);
+  ASSERT_EQUAL(stats.upstream_allocations, stats.upstream_deallocations);
+}
+DECLARE_UNITTEST(TestHostCachingResourceMaxBytesCached);
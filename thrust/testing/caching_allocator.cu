@@ -22,3 +22,9 @@ void TestSingleDeviceTLSCachingAllocator()
   test_implementation(thrust::detail::single_device_tls_caching_allocator());
 };
 DECLARE_UNITTEST(TestSingleDeviceTLSCachingAllocator);
+
+void TestSingleHostTLSCachingAllocator()
+{
+  test_implementation(thrust::detail::single_host_tls_caching_allocator());
+};
+DECLARE_UNITTEST(TestSingleHostTLSCachingAllocator);
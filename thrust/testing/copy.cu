@@ -143,6 +143,36 @@ void TestCopyMatchingTypes()
 }
 DECLARE_VECTOR_UNITTEST(TestCopyMatchingTypes);
 
+template <class Vector>
+void TestCopyLargeTrivial()
+{
+  using T = typename Vector::value_type;
+
+  // several chunks of the parallel host copies, plus a partial one
+  const size_t n = (size_t(1) << 20) + 3;
+
+  Vector v(n);
+  thrust::sequence(v.begin(), v.end());
+
+  Vector d(n, T(0));
+  typename Vector::iterator d_result = thrust::copy(v.begin(), v.end(), d.begin());
+  ASSERT_EQUAL(v, d);
+  ASSERT_EQUAL_QUIET(d_result, d.end());
+
+  // a copy into the same vector which does not overlap
+  Vector w(2 * n, T(0));
+  thrust::copy_n(v.begin(), n, w.begin() + n);
+  ASSERT_EQUAL(w[n - 1], T(0));
+  ASSERT_EQUAL(Vector(w.begin() + n, w.end()), v);
+
+  // copy construction and reallocation go through the same copies
+  Vector c(v);
+  ASSERT_EQUAL(c, v);
+  c.reserve(2 * n);
+  ASSERT_EQUAL(c, v);
+}
+DECLARE_VECTOR_UNITTEST(TestCopyLargeTrivial);
+
 template <class Vector>
 void TestCopyMixedTypes()
 {
@@ -104,6 +104,33 @@ struct TestInnerProduct
 };
 VariableUnitTest<TestInnerProduct, IntegralTypes> TestInnerProductInstance;
 
+template <typename T>
+struct TestInnerProductInOrder
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_v1 = unittest::random_integers<T>(n);
+    thrust::host_vector<T> h_v2 = unittest::random_integers<T>(n);
+
+    thrust::device_vector<T> d_v1 = h_v1;
+    thrust::device_vector<T> d_v2 = h_v2;
+
+    T init = 13;
+
+    T expected = init;
+    for (size_t i = 0; i < n; i++)
+    {
+      expected = expected + h_v1[i] * h_v2[i];
+    }
+
+    ASSERT_EQUAL(expected, thrust::inner_product(h_v1.begin(), h_v1.end(), h_v2.begin(), init));
+    ASSERT_EQUAL(expected, thrust::inner_product(d_v1.begin(), d_v1.end(), d_v2.begin(), init));
+  }
+};
+// unsigned types which are not promoted to int, so their products wrap around
+VariableUnitTest<TestInnerProductInOrder, unittest::type_list<unsigned int, unsigned long, unsigned long long>>
+  TestInnerProductInOrderInstance;
+
 struct only_set_when_both_expected
 {
   long long expected;
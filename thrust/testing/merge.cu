@@ -6,6 +6,9 @@
 #include <thrust/sort.h>
 #include <thrust/unique.h>
 
+#include <algorithm>
+
+#include <unittest/skewed_inputs.h>
 #include <unittest/unittest.h>
 
 template <typename Vector>
@@ -98,6 +101,20 @@ void TestMerge(size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestMerge);
 
+template <typename T>
+void TestMergeSkewed(const size_t n)
+{
+  unittest::check_skewed_inputs<T>(
+    n,
+    [](auto... args) {
+      return std::merge(args...);
+    },
+    [](auto... args) {
+      return thrust::merge(args...);
+    });
+}
+DECLARE_VARIABLE_UNITTEST(TestMergeSkewed);
+
 template <typename T>
 void TestMergeToDiscardIterator(size_t n)
 {
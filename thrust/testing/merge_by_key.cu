@@ -2,9 +2,15 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/merge.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 #include <thrust/unique.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <unittest/skewed_inputs.h>
 #include <unittest/unittest.h>
 
 template <typename Vector>
@@ -198,6 +204,63 @@ void TestMergeByKey(size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestMergeByKey);
 
+template <typename T>
+void TestMergeByKeySkewed(size_t n)
+{
+  thrust::host_vector<T> h_a_keys, h_b_keys;
+  unittest::sorted_skewed_inputs(n, h_a_keys, h_b_keys);
+
+  // the values tell which input and position each key came from
+  thrust::host_vector<int> h_a_vals(h_a_keys.size());
+  thrust::host_vector<int> h_b_vals(h_b_keys.size());
+  thrust::sequence(h_a_vals.begin(), h_a_vals.end());
+  thrust::sequence(h_b_vals.begin(), h_b_vals.end(), static_cast<int>(h_a_keys.size()));
+
+  std::vector<std::pair<T, int>> a, b, expected(h_a_keys.size() + h_b_keys.size());
+  for (size_t i = 0; i < h_a_keys.size(); i++)
+  {
+    a.push_back(std::make_pair(h_a_keys[i], h_a_vals[i]));
+  }
+  for (size_t i = 0; i < h_b_keys.size(); i++)
+  {
+    b.push_back(std::make_pair(h_b_keys[i], h_b_vals[i]));
+  }
+  auto key_less = [](const std::pair<T, int>& x, const std::pair<T, int>& y) {
+    return x.first < y.first;
+  };
+  std::merge(a.begin(), a.end(), b.begin(), b.end(), expected.begin(), key_less);
+
+  thrust::host_vector<T> h_expected_keys(expected.size());
+  thrust::host_vector<int> h_expected_vals(expected.size());
+  for (size_t i = 0; i < expected.size(); i++)
+  {
+    h_expected_keys[i] = expected[i].first;
+    h_expected_vals[i] = expected[i].second;
+  }
+
+  const thrust::device_vector<T> d_a_keys   = h_a_keys;
+  const thrust::device_vector<T> d_b_keys   = h_b_keys;
+  const thrust::device_vector<int> d_a_vals = h_a_vals;
+  const thrust::device_vector<int> d_b_vals = h_b_vals;
+
+  thrust::device_vector<T> d_result_keys(expected.size());
+  thrust::device_vector<int> d_result_vals(expected.size());
+
+  thrust::merge_by_key(
+    d_a_keys.begin(),
+    d_a_keys.end(),
+    d_b_keys.begin(),
+    d_b_keys.end(),
+    d_a_vals.begin(),
+    d_b_vals.begin(),
+    d_result_keys.begin(),
+    d_result_vals.begin());
+
+  ASSERT_EQUAL(h_expected_keys, d_result_keys);
+  ASSERT_EQUAL(h_expected_vals, d_result_vals);
+}
+DECLARE_VARIABLE_UNITTEST(TestMergeByKeySkewed);
+
 template <typename T>
 void TestMergeByKeyToDiscardIterator(size_t n)
 {
@@ -0,0 +1,87 @@
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+#include <unittest/unittest.h>
+
+using thrust::system::detail::internal::merge_path;
+
+void TestMergePathSimple()
+{
+  // merge of {0, 2, 4} and {0, 3, 3, 4} is {0a, 0b, 2a, 3b, 3b, 4a, 4b}
+  const int a[] = {0, 2, 4};
+  const int b[] = {0, 3, 3, 4};
+
+  const int ref[] = {0, 1, 1, 2, 2, 2, 3, 3};
+
+  for (int diag = 0; diag <= 7; ++diag)
+  {
+    ASSERT_EQUAL(merge_path(a, 3, b, 4, diag, thrust::less<int>()), ref[diag]);
+  }
+}
+DECLARE_UNITTEST(TestMergePathSimple);
+
+void TestMergePathEmpty()
+{
+  const int a[] = {1, 2, 3};
+
+  ASSERT_EQUAL(merge_path(a, 0, a, 3, 0, thrust::less<int>()), 0);
+  ASSERT_EQUAL(merge_path(a, 0, a, 3, 2, thrust::less<int>()), 0);
+  ASSERT_EQUAL(merge_path(a, 3, a, 0, 0, thrust::less<int>()), 0);
+  ASSERT_EQUAL(merge_path(a, 3, a, 0, 2, thrust::less<int>()), 2);
+}
+DECLARE_UNITTEST(TestMergePathEmpty);
+
+template <typename T>
+void TestMergePath(const size_t n)
+{
+  const size_t n1 = n / 3;
+  const size_t n2 = n - n1;
+
+  thrust::host_vector<T> a = unittest::random_integers<T>(n1);
+  thrust::host_vector<T> b = unittest::random_integers<T>(n2);
+
+  thrust::sort(a.begin(), a.end());
+  thrust::sort(b.begin(), b.end());
+
+  // every prefix of the stable merge takes merge_path elements from a
+  size_t i = 0, j = 0;
+
+  for (size_t diag = 0; diag <= n; ++diag)
+  {
+    ASSERT_EQUAL(merge_path(a.begin(), n1, b.begin(), n2, diag, thrust::less<T>()), i);
+
+    if (j == n2 || (i < n1 && !(b[j] < a[i])))
+    {
+      ++i;
+    }
+    else
+    {
+      ++j;
+    }
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestMergePath);
+
+void TestSetOperationPathSimple()
+{
+  using thrust::system::detail::internal::set_operation_path;
+
+  // merge of {0, 2, 2, 4} and {2, 2, 3} is {0a, 2a, 2a, 2b, 2b, 3b, 4a}
+  const int a[] = {0, 2, 2, 4};
+  const int b[] = {2, 2, 3};
+
+  // splits never separate equivalent elements
+  const int ref1[] = {0, 1, 1, 1, 1, 3, 3, 4};
+  const int ref2[] = {0, 0, 0, 0, 0, 2, 3, 3};
+
+  for (int diag = 0; diag <= 7; ++diag)
+  {
+    thrust::pair<int, int> split = set_operation_path(a, 4, b, 3, diag, thrust::less<int>());
+
+    ASSERT_EQUAL(split.first, ref1[diag]);
+    ASSERT_EQUAL(split.second, ref2[diag]);
+  }
+}
+DECLARE_UNITTEST(TestSetOperationPathSimple);
@@ -1,8 +1,11 @@
 #include <thrust/detail/config.h>
 
 #include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/disjoint_sharded_pool.h>
 #include <thrust/mr/disjoint_sync_pool.h>
+#include <thrust/mr/disjoint_tls_pool.h>
 #include <thrust/mr/new.h>
+#include <thrust/mr/statistics.h>
 
 #include <unittest/unittest.h>
 
@@ -185,6 +188,18 @@ void TestDisjointSynchronizedPool()
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPool);
 
+void TestDisjointShardedPool()
+{
+  TestDisjointPool<thrust::mr::disjoint_sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointShardedPool);
+
+void TestDisjointTlsPool()
+{
+  TestDisjointPool<thrust::mr::disjoint_tls_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointTlsPool);
+
 template <template <typename, typename> class PoolTemplate>
 void TestDisjointPoolCachingOversized()
 {
@@ -263,6 +278,18 @@ void TestDisjointSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPoolCachingOversized);
 
+void TestDisjointShardedPoolCachingOversized()
+{
+  TestDisjointPoolCachingOversized<thrust::mr::disjoint_sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointShardedPoolCachingOversized);
+
+void TestDisjointTlsPoolCachingOversized()
+{
+  TestDisjointPoolCachingOversized<thrust::mr::disjoint_tls_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointTlsPoolCachingOversized);
+
 template <template <typename, typename> class PoolTemplate>
 void TestDisjointGlobalPool()
 {
@@ -282,3 +309,73 @@ void TestSynchronizedDisjointGlobalPool()
   TestDisjointGlobalPool<thrust::mr::disjoint_synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedDisjointGlobalPool);
+
+void TestShardedDisjointGlobalPool()
+{
+  TestDisjointGlobalPool<thrust::mr::disjoint_sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedDisjointGlobalPool);
+
+void TestTlsDisjointGlobalPool()
+{
+  TestDisjointGlobalPool<thrust::mr::disjoint_tls_pool_resource>();
+}
+DECLARE_UNITTEST(TestTlsDisjointGlobalPool);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolStatistics()
+{
+  using upstream_type = thrust::mr::statistics_resource<thrust::mr::new_delete_resource>;
+  using Pool          = PoolTemplate<upstream_type, thrust::mr::new_delete_resource>;
+
+  upstream_type upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  Pool pool(&upstream, &bookkeeper);
+
+  void* a = pool.do_allocate(100, 16);
+  void* b = pool.do_allocate(128, 16);
+  void* c = pool.do_allocate(1 << 21, 16);
+  pool.do_deallocate(c, 1 << 21, 16);
+  c = pool.do_allocate(1 << 20 | 1, 16);
+
+  thrust::mr::pool_statistics stats = pool.get_stats();
+  ASSERT_EQUAL(stats.allocations, 4u);
+  ASSERT_EQUAL(stats.cache_hits, 2u);
+  ASSERT_EQUAL(stats.oversized_allocations, 2u);
+  ASSERT_EQUAL(stats.oversized_cache_hits, 1u);
+  ASSERT_EQUAL(stats.upstream_allocations, 2u);
+  ASSERT_EQUAL(stats.bytes_in_use, 256u + (1 << 21));
+  ASSERT_EQUAL(stats.bytes_upstream, upstream.get_stats().bytes_in_use);
+  ASSERT_EQUAL(stats.bytes_upstream, stats.bytes_in_use + stats.bytes_cached);
+
+  pool.do_deallocate(a, 100, 16);
+  pool.do_deallocate(b, 128, 16);
+  pool.do_deallocate(c, 1 << 20 | 1, 16);
+
+  stats = pool.get_stats();
+  ASSERT_EQUAL(stats.deallocations, 4u);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 256u + (1 << 21));
+  ASSERT_EQUAL(stats.bytes_cached, stats.bytes_upstream);
+
+  pool.release();
+
+  stats = pool.get_stats();
+  ASSERT_EQUAL(stats.upstream_deallocations, 2u);
+  ASSERT_EQUAL(stats.bytes_upstream, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_upstream, upstream.get_stats().peak_bytes_in_use);
+  ASSERT_EQUAL(upstream.get_stats().bytes_in_use, 0u);
+}
+
+void TestDisjointUnsynchronizedPoolStatistics()
+{
+  TestDisjointPoolStatistics<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolStatistics);
+
+void TestDisjointSynchronizedPoolStatistics()
+{
+  TestDisjointPoolStatistics<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolStatistics);
@@ -0,0 +1,136 @@
+#include <thrust/mr/mmap.h>
+
+#include <unittest/unittest.h>
+
+#if defined(__linux__)
+
+#  include <thrust/host_vector.h>
+#  include <thrust/mr/allocator.h>
+#  include <thrust/mr/pool.h>
+#  include <thrust/sequence.h>
+#  include <thrust/sort.h>
+
+#  include <cstdint>
+#  include <cstring>
+#  include <new>
+
+template <typename MemoryResource>
+void TestMmapAllocation(MemoryResource& memres, std::size_t size, std::size_t alignment)
+{
+  void* ptr = memres.do_allocate(size, alignment);
+  ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+  if (memres.options().alignment > 0)
+  {
+    ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(ptr) % memres.options().alignment, 0u);
+  }
+
+  std::memset(ptr, 0xab, size);
+  ASSERT_EQUAL(static_cast<unsigned char*>(ptr)[size - 1], 0xab);
+
+  memres.do_deallocate(ptr, size, alignment);
+}
+
+void TestMmapResource()
+{
+  thrust::mr::mmap_memory_resource memres;
+
+  for (std::size_t size = 1; size <= (1 << 22); size = size * 3 + 1)
+  {
+    for (std::size_t alignment = 16; alignment <= (1 << 22); alignment <<= 3)
+    {
+      TestMmapAllocation(memres, size, alignment);
+    }
+  }
+}
+DECLARE_UNITTEST(TestMmapResource);
+
+void TestMmapResourceOptions()
+{
+  thrust::mr::mmap_options options = thrust::mr::mmap_memory_resource::get_default_options();
+  options.populate                 = true;
+  options.alignment                = 1 << 16;
+
+  thrust::mr::mmap_memory_resource memres(options);
+
+  TestMmapAllocation(memres, 100, 16);
+  TestMmapAllocation(memres, 1 << 20, 1 << 20);
+}
+DECLARE_UNITTEST(TestMmapResourceOptions);
+
+void TestHugePageResource()
+{
+  thrust::mr::huge_page_memory_resource memres;
+  ASSERT_EQUAL(memres.options().huge_pages == thrust::mr::huge_page_mode::transparent, true);
+
+  TestMmapAllocation(memres, 1 << 23, 64);
+
+  thrust::mr::mmap_options options = thrust::mr::huge_page_memory_resource::get_default_options();
+  options.populate                 = true;
+
+  thrust::mr::huge_page_memory_resource populated(options);
+  TestMmapAllocation(populated, (1 << 22) + 1, 64);
+}
+DECLARE_UNITTEST(TestHugePageResource);
+
+void TestHugeTlbResource()
+{
+  thrust::mr::mmap_options options = thrust::mr::huge_page_memory_resource::get_default_options();
+  options.huge_pages               = thrust::mr::huge_page_mode::hugetlb;
+
+  thrust::mr::huge_page_memory_resource memres(options);
+
+  // the system may have no huge pages reserved, in which case the allocation must fail cleanly
+  try
+  {
+    TestMmapAllocation(memres, 100, 16);
+  }
+  catch (const std::bad_alloc&)
+  {}
+}
+DECLARE_UNITTEST(TestHugeTlbResource);
+
+void TestNumaResource()
+{
+  thrust::mr::numa_memory_resource interleaved;
+  ASSERT_EQUAL(interleaved.options().numa == thrust::mr::numa_policy::interleave, true);
+  TestMmapAllocation(interleaved, 1 << 20, 64);
+
+  thrust::mr::mmap_options options = thrust::mr::numa_memory_resource::get_default_options();
+  options.numa                     = thrust::mr::numa_policy::bind;
+  options.numa_nodes               = 1;
+  options.populate                 = true;
+
+  thrust::mr::numa_memory_resource bound(options);
+  TestMmapAllocation(bound, 1 << 20, 64);
+}
+DECLARE_UNITTEST(TestNumaResource);
+
+void TestMmapResourceAsPoolUpstream()
+{
+  thrust::mr::mmap_memory_resource upstream;
+  thrust::mr::unsynchronized_pool_resource<thrust::mr::mmap_memory_resource> pool(&upstream);
+
+  void* a = pool.do_allocate(100, 16);
+  void* b = pool.do_allocate(1 << 21, 16);
+  std::memset(a, 1, 100);
+  std::memset(b, 2, 1 << 21);
+  pool.do_deallocate(a, 100, 16);
+  pool.do_deallocate(b, 1 << 21, 16);
+}
+DECLARE_UNITTEST(TestMmapResourceAsPoolUpstream);
+
+void TestHugePageResourceHostVector()
+{
+  using allocator = thrust::mr::stateless_resource_allocator<int, thrust::mr::huge_page_memory_resource>;
+
+  thrust::host_vector<int, allocator> v(1 << 20);
+  thrust::sequence(v.begin(), v.end());
+  thrust::sort(v.begin(), v.end(), thrust::greater<int>());
+
+  ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(thrust::raw_pointer_cast(v.data())) % (1 << 21), 0u);
+  ASSERT_EQUAL(v.front(), (1 << 20) - 1);
+  ASSERT_EQUAL(v.back(), 0);
+}
+DECLARE_UNITTEST(TestHugePageResourceHostVector);
+
+#endif // __linux__
@@ -0,0 +1,172 @@
+#include <thrust/execution_policy.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/monotonic_buffer.h>
+#include <thrust/mr/new.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+  virtual void* do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    ++allocations;
+    bytes_in_use += n;
+    return upstream.do_allocate(n, alignment);
+  }
+
+  virtual void do_deallocate(void* p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes_in_use -= n;
+    upstream.do_deallocate(p, n, alignment);
+  }
+
+  std::size_t allocations  = 0;
+  std::size_t bytes_in_use = 0;
+
+private:
+  thrust::mr::new_delete_resource upstream;
+};
+
+void TestMonotonicBufferUpstream()
+{
+  counting_resource upstream;
+
+  {
+    thrust::mr::monotonic_buffer_resource<counting_resource> resource(&upstream, 1024);
+
+    // the first allocation gets a buffer, and the next ones are carved out of it
+    void* a1 = resource.do_allocate(100, 16);
+    ASSERT_EQUAL(upstream.allocations, 1u);
+    void* a2 = resource.do_allocate(100, 64);
+    ASSERT_EQUAL(upstream.allocations, 1u);
+    ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(a2) % 64, 0u);
+    ASSERT_EQUAL(static_cast<char*>(a2) >= static_cast<char*>(a1) + 100, true);
+
+    // deallocation is a no-op
+    resource.do_deallocate(a1, 100, 16);
+    resource.do_deallocate(a2, 100, 64);
+    ASSERT_EQUAL(upstream.bytes_in_use, 1024u);
+
+    // running out of the buffer gets a bigger one
+    void* a3 = resource.do_allocate(1000, 16);
+    ASSERT_EQUAL(upstream.allocations, 2u);
+    ASSERT_EQUAL(upstream.bytes_in_use, 1024u + 2048u);
+
+    // and requests bigger than the next buffer get one that fits them
+    void* a4 = resource.do_allocate(10000, 256);
+    ASSERT_EQUAL(upstream.allocations, 3u);
+    ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(a4) % 256, 0u);
+    ASSERT_GEQUAL(upstream.bytes_in_use, 1024u + 2048u + 10000u);
+
+    (void) a3;
+
+    // release returns everything to upstream
+    resource.release();
+    ASSERT_EQUAL(upstream.bytes_in_use, 0u);
+
+    void* a5 = resource.do_allocate(100, 16);
+    ASSERT_EQUAL(upstream.allocations, 4u);
+    ASSERT_EQUAL(upstream.bytes_in_use, 1024u);
+
+    (void) a5;
+  }
+
+  // and so does destruction
+  ASSERT_EQUAL(upstream.bytes_in_use, 0u);
+}
+DECLARE_UNITTEST(TestMonotonicBufferUpstream);
+
+void TestMonotonicBufferHugeAllocation()
+{
+  counting_resource upstream;
+  thrust::mr::monotonic_buffer_resource<counting_resource> resource(&upstream, 1024);
+
+  // the buffer size cannot double past these, and no buffer is requested for them
+  const std::size_t max_size = (std::numeric_limits<std::size_t>::max)();
+  ASSERT_THROWS((void) resource.do_allocate(max_size, 16), std::bad_alloc);
+  ASSERT_THROWS((void) resource.do_allocate(max_size / 2 + 2, 16), std::bad_alloc);
+  ASSERT_EQUAL(upstream.allocations, 0u);
+
+  // the resource is still usable afterwards
+  void* p = resource.do_allocate(100, 16);
+  ASSERT_EQUAL(upstream.allocations, 1u);
+  ASSERT_EQUAL(upstream.bytes_in_use, 1024u);
+
+  // and does not hand out the rest of its buffer to a request which does not fit
+  ASSERT_THROWS((void) resource.do_allocate(max_size - 8, 16), std::bad_alloc);
+  ASSERT_EQUAL(upstream.allocations, 1u);
+
+  (void) p;
+}
+DECLARE_UNITTEST(TestMonotonicBufferHugeAllocation);
+
+void TestMonotonicBufferCallerBuffer()
+{
+  counting_resource upstream;
+
+  alignas(64) char buffer[1024];
+
+  thrust::mr::monotonic_buffer_resource<counting_resource> resource(buffer, sizeof(buffer), &upstream);
+
+  for (std::size_t i = 0; i < 8; ++i)
+  {
+    char* p = static_cast<char*>(resource.do_allocate(100, 8 << (i % 4)));
+    ASSERT_EQUAL(p >= buffer && p + 100 <= buffer + sizeof(buffer), true);
+    ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(p) % (8 << (i % 4)), 0u);
+  }
+  ASSERT_EQUAL(upstream.allocations, 0u);
+
+  // past the end of the caller's buffer, memory comes from upstream
+  void* p = resource.do_allocate(1024, 16);
+  ASSERT_EQUAL(upstream.allocations, 1u);
+  ASSERT_EQUAL(static_cast<char*>(p) >= buffer && static_cast<char*>(p) < buffer + sizeof(buffer), false);
+
+  // and after a release, from the caller's buffer again
+  resource.release();
+  ASSERT_EQUAL(upstream.bytes_in_use, 0u);
+  ASSERT_EQUAL(static_cast<char*>(resource.do_allocate(100, 16)), buffer);
+}
+DECLARE_UNITTEST(TestMonotonicBufferCallerBuffer);
+
+void TestMonotonicBufferWithAllocator()
+{
+  counting_resource upstream;
+
+  const std::size_t n = 1 << 16;
+  std::vector<char> buffer(16 * n * sizeof(int));
+
+  thrust::mr::monotonic_buffer_resource<counting_resource> resource(buffer.data(), buffer.size(), &upstream);
+  thrust::mr::allocator<int, thrust::mr::monotonic_buffer_resource<counting_resource>> alloc(&resource);
+
+  // a chain of algorithms using the resource for their temporary storage does not touch upstream when the caller's
+  // buffer is big enough for all of them
+  std::vector<int> keys(n);
+  std::vector<int> values(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast<int>((i * 7919) % n);
+  }
+  thrust::sequence(thrust::host(alloc), values.begin(), values.end());
+
+  thrust::sort_by_key(thrust::host(alloc), keys.begin(), keys.end(), values.begin());
+  thrust::stable_sort(thrust::host(alloc), values.begin(), values.end());
+
+  ASSERT_EQUAL(upstream.allocations, 0u);
+
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(keys[i], static_cast<int>(i));
+    ASSERT_EQUAL(values[i], static_cast<int>(i));
+  }
+
+  resource.release();
+}
+DECLARE_UNITTEST(TestMonotonicBufferWithAllocator);
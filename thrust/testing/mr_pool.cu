@@ -2,7 +2,14 @@
 
 #include <thrust/mr/new.h>
 #include <thrust/mr/pool.h>
+#include <thrust/mr/sharded_pool.h>
+#include <thrust/mr/statistics.h>
 #include <thrust/mr/sync_pool.h>
+#include <thrust/mr/tls_pool.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include <unittest/unittest.h>
 
@@ -244,6 +251,18 @@ void TestSynchronizedPool()
 }
 DECLARE_UNITTEST(TestSynchronizedPool);
 
+void TestShardedPool()
+{
+  TestPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPool);
+
+void TestTlsPool()
+{
+  TestPool<thrust::mr::tls_pool_resource>();
+}
+DECLARE_UNITTEST(TestTlsPool);
+
 template <template <typename> class PoolTemplate>
 void TestPoolCachingOversized()
 {
@@ -353,6 +372,18 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+void TestShardedPoolCachingOversized()
+{
+  TestPoolCachingOversized<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolCachingOversized);
+
+void TestTlsPoolCachingOversized()
+{
+  TestPoolCachingOversized<thrust::mr::tls_pool_resource>();
+}
+DECLARE_UNITTEST(TestTlsPoolCachingOversized);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -372,3 +403,315 @@ void TestSynchronizedGlobalPool()
   TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
+
+void TestShardedGlobalPool()
+{
+  TestGlobalPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedGlobalPool);
+
+void TestTlsGlobalPool()
+{
+  TestGlobalPool<thrust::mr::tls_pool_resource>();
+}
+DECLARE_UNITTEST(TestTlsGlobalPool);
+
+template <template <typename> class PoolTemplate>
+void TestPoolCrossThreadDeallocation()
+{
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.largest_block_size       = 4096;
+
+  Pool pool(opts);
+
+  const std::size_t num_threads = 4;
+  const std::size_t num_blocks  = 1000;
+
+  // every thread fills blocks of varying sizes, some of them oversized, which the next thread checks and deallocates
+  std::vector<std::vector<void*>> blocks(num_threads);
+  std::vector<std::thread> threads;
+
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      for (std::size_t i = 0; i < num_blocks; ++i)
+      {
+        const std::size_t size = 8 << (i % 11);
+        void* p                = pool.allocate(size);
+        std::memset(p, static_cast<int>(t + 1), size);
+        blocks[t].push_back(p);
+      }
+    });
+  }
+
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  threads.clear();
+
+  std::vector<std::size_t> mismatches(num_threads, 0);
+
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      const std::size_t owner = (t + 1) % num_threads;
+      for (std::size_t i = 0; i < num_blocks; ++i)
+      {
+        const std::size_t size = 8 << (i % 11);
+        const char* p          = static_cast<const char*>(blocks[owner][i]);
+        for (std::size_t j = 0; j < size; ++j)
+        {
+          mismatches[t] += p[j] != static_cast<char>(owner + 1);
+        }
+        pool.deallocate(blocks[owner][i], size);
+      }
+    });
+  }
+
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    ASSERT_EQUAL(mismatches[t], 0u);
+  }
+
+  pool.release();
+}
+
+void TestSynchronizedPoolCrossThreadDeallocation()
+{
+  TestPoolCrossThreadDeallocation<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCrossThreadDeallocation);
+
+void TestShardedPoolCrossThreadDeallocation()
+{
+  TestPoolCrossThreadDeallocation<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolCrossThreadDeallocation);
+
+void TestTlsPoolCrossThreadDeallocation()
+{
+  TestPoolCrossThreadDeallocation<thrust::mr::tls_pool_resource>();
+}
+DECLARE_UNITTEST(TestTlsPoolCrossThreadDeallocation);
+
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+  virtual void* do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes_in_use += n;
+    return upstream.do_allocate(n, alignment);
+  }
+
+  virtual void do_deallocate(void* p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes_in_use -= n;
+    upstream.do_deallocate(p, n, alignment);
+  }
+
+  std::atomic<std::size_t> bytes_in_use{0};
+
+private:
+  thrust::mr::new_delete_resource upstream;
+};
+
+void TestTlsPoolProducerConsumer()
+{
+  counting_resource upstream;
+
+  thrust::mr::pool_options opts = thrust::mr::tls_pool_resource<counting_resource>::get_default_options();
+  opts.max_bytes_per_thread_cache = 1024;
+
+  thrust::mr::tls_pool_resource<counting_resource> pool(&upstream, opts);
+
+  const std::size_t num_rounds = 100;
+  const std::size_t num_blocks = 64;
+  const std::size_t size       = 64;
+
+  // this thread allocates, and a new thread deallocates, every round; the blocks the consumers free must be reused,
+  // rather than pile up in caches, including those of the consumers that have exited
+  for (std::size_t round = 0; round < num_rounds; ++round)
+  {
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+      blocks.push_back(pool.allocate(size));
+    }
+
+    std::thread consumer([&] {
+      for (void* p : blocks)
+      {
+        pool.deallocate(p, size);
+      }
+    });
+    consumer.join();
+  }
+
+  ASSERT_LESS(upstream.bytes_in_use.load(), num_rounds * num_blocks * size / 8);
+}
+DECLARE_UNITTEST(TestTlsPoolProducerConsumer);
+
+template <template <typename> class PoolTemplate>
+void TestPoolStatistics()
+{
+  using upstream_type = thrust::mr::statistics_resource<thrust::mr::new_delete_resource>;
+  using pool_type     = PoolTemplate<upstream_type>;
+
+  upstream_type upstream;
+  pool_type pool(&upstream);
+
+  // the pool allocates its bookkeeping from upstream too, which its own statistics leave out
+  const std::size_t baseline = upstream.get_stats().bytes_in_use;
+
+  void* a = pool.do_allocate(100, 16);
+  void* b = pool.do_allocate(128, 16);
+
+  thrust::mr::pool_statistics stats = pool.get_stats();
+  ASSERT_EQUAL(stats.allocations, 2u);
+  ASSERT_EQUAL(stats.cache_hits, 1u);
+  ASSERT_EQUAL(stats.upstream_allocations, 1u);
+  ASSERT_EQUAL(stats.bytes_in_use, 256u);
+  ASSERT_EQUAL(stats.bytes_upstream, upstream.get_stats().bytes_in_use - baseline);
+  ASSERT_GEQUAL(stats.bytes_upstream, stats.bytes_in_use + stats.bytes_cached);
+
+  void* c = pool.do_allocate(1 << 21, 16);
+  pool.do_deallocate(c, 1 << 21, 16);
+  c = pool.do_allocate(1 << 21, 16);
+
+  stats = pool.get_stats();
+  ASSERT_EQUAL(stats.allocations, 4u);
+  ASSERT_EQUAL(stats.oversized_allocations, 2u);
+  ASSERT_EQUAL(stats.oversized_cache_hits, 1u);
+  ASSERT_EQUAL(stats.cache_hits, 2u);
+  ASSERT_EQUAL(stats.upstream_allocations, 2u);
+  ASSERT_EQUAL(stats.bytes_in_use, 256u + (1 << 21));
+  ASSERT_EQUAL(stats.bytes_upstream, upstream.get_stats().bytes_in_use - baseline);
+
+  pool.do_deallocate(a, 100, 16);
+  pool.do_deallocate(b, 128, 16);
+  pool.do_deallocate(c, 1 << 21, 16);
+
+  stats = pool.get_stats();
+  ASSERT_EQUAL(stats.deallocations, 4u);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 256u + (1 << 21));
+  ASSERT_GEQUAL(stats.bytes_cached, 256u + (1 << 21));
+  ASSERT_EQUAL(stats.upstream_deallocations, 0u);
+
+  pool.release();
+
+  stats = pool.get_stats();
+  ASSERT_EQUAL(stats.upstream_deallocations, 2u);
+  ASSERT_EQUAL(stats.bytes_cached, 0u);
+  ASSERT_EQUAL(stats.bytes_upstream, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_upstream, upstream.get_stats().peak_bytes_in_use - baseline);
+  ASSERT_EQUAL(upstream.get_stats().bytes_in_use, baseline);
+}
+
+void TestUnsynchronizedPoolStatistics()
+{
+  TestPoolStatistics<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolStatistics);
+
+void TestSynchronizedPoolStatistics()
+{
+  TestPoolStatistics<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolStatistics);
+
+template <template <typename> class PoolTemplate>
+void TestCachingPoolStatistics()
+{
+  PoolTemplate<thrust::mr::new_delete_resource> pool;
+
+  for (int i = 0; i < 2; ++i)
+  {
+    void* p = pool.do_allocate(64, 16);
+    pool.do_deallocate(p, 64, 16);
+  }
+
+  // the statistics are those of the shared pool, which the second allocation never reaches
+  thrust::mr::pool_statistics stats = pool.get_stats();
+  ASSERT_EQUAL(stats.upstream_allocations, 1u);
+  ASSERT_GEQUAL(stats.bytes_upstream, stats.bytes_in_use + stats.bytes_cached);
+
+  pool.release();
+  ASSERT_EQUAL(pool.get_stats().bytes_upstream, 0u);
+}
+
+void TestShardedPoolStatistics()
+{
+  TestCachingPoolStatistics<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolStatistics);
+
+void TestTlsPoolStatistics()
+{
+  TestCachingPoolStatistics<thrust::mr::tls_pool_resource>();
+}
+DECLARE_UNITTEST(TestTlsPoolStatistics);
+
+template <template <typename> class PoolTemplate>
+void TestPoolOversizedBestFit()
+{
+  using upstream_type = thrust::mr::statistics_resource<thrust::mr::new_delete_resource>;
+
+  upstream_type upstream;
+  PoolTemplate<upstream_type> pool(&upstream);
+
+  const std::size_t mib = 1 << 20;
+
+  void* big    = pool.do_allocate(32 * mib, 16);
+  void* small  = pool.do_allocate(2 * mib, 16);
+  void* medium = pool.do_allocate(3 * mib, 16);
+  void* huge   = pool.do_allocate(64 * mib, 4096);
+  pool.do_deallocate(big, 32 * mib, 16);
+  pool.do_deallocate(small, 2 * mib, 16);
+  pool.do_deallocate(medium, 3 * mib, 16);
+  pool.do_deallocate(huge, 64 * mib, 4096);
+
+  const std::size_t upstream_allocations = upstream.get_stats().allocations;
+
+  // the smallest block that fits is used, regardless of the order the blocks were cached in
+  void* p = pool.do_allocate(2 * mib + 1, 16);
+  ASSERT_EQUAL(p, medium);
+
+  // a block of the same size with a higher alignment within the cutoff also fits
+  void* q = pool.do_allocate(64 * mib, 1024);
+  ASSERT_EQUAL(q, huge);
+
+  void* r = pool.do_allocate(mib + 1, 16);
+  ASSERT_EQUAL(r, small);
+  ASSERT_EQUAL(upstream.get_stats().allocations, upstream_allocations);
+
+  // the remaining block is too big by the size cutoff factor, so a new one is allocated
+  void* s = pool.do_allocate(mib + 1, 16);
+  ASSERT_EQUAL(s != big, true);
+  ASSERT_EQUAL(upstream.get_stats().allocations, upstream_allocations + 1);
+
+  pool.do_deallocate(p, 2 * mib + 1, 16);
+  pool.do_deallocate(q, 64 * mib, 1024);
+  pool.do_deallocate(r, mib + 1, 16);
+  pool.do_deallocate(s, mib + 1, 16);
+}
+
+void TestUnsynchronizedPoolOversizedBestFit()
+{
+  TestPoolOversizedBestFit<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolOversizedBestFit);
+
+void TestSynchronizedPoolOversizedBestFit()
+{
+  TestPoolOversizedBestFit<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolOversizedBestFit);
@@ -0,0 +1,162 @@
+#include <thrust/host_vector.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/statistics.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+using statistics_resource = thrust::mr::statistics_resource<thrust::mr::new_delete_resource>;
+
+void TestStatisticsResource()
+{
+  statistics_resource resource;
+
+  void* a = resource.do_allocate(100, 16);
+  void* b = resource.do_allocate(1000, 64);
+
+  thrust::mr::allocation_statistics stats = resource.get_stats();
+  ASSERT_EQUAL(stats.allocations, 2u);
+  ASSERT_EQUAL(stats.deallocations, 0u);
+  ASSERT_EQUAL(stats.bytes_allocated, 1100u);
+  ASSERT_EQUAL(stats.bytes_in_use, 1100u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 1100u);
+
+  // without a histogram, all its entries are zero
+  for (std::size_t i = 0; i < thrust::mr::allocation_size_histogram_size; ++i)
+  {
+    ASSERT_EQUAL(stats.size_histogram[i], 0u);
+  }
+
+  resource.do_deallocate(a, 100, 16);
+  void* c = resource.do_allocate(10, 16);
+
+  stats = resource.get_stats();
+  ASSERT_EQUAL(stats.allocations, 3u);
+  ASSERT_EQUAL(stats.deallocations, 1u);
+  ASSERT_EQUAL(stats.bytes_deallocated, 100u);
+  ASSERT_EQUAL(stats.bytes_in_use, 1010u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 1100u);
+
+  // a reset keeps track of the memory still in use
+  resource.reset_stats();
+
+  stats = resource.get_stats();
+  ASSERT_EQUAL(stats.allocations, 0u);
+  ASSERT_EQUAL(stats.bytes_in_use, 1010u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 1010u);
+
+  resource.do_deallocate(b, 1000, 64);
+  resource.do_deallocate(c, 10, 16);
+
+  stats = resource.get_stats();
+  ASSERT_EQUAL(stats.deallocations, 2u);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+}
+DECLARE_UNITTEST(TestStatisticsResource);
+
+void TestStatisticsResourceHistogram()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::statistics_resource<thrust::mr::new_delete_resource> resource(&upstream, true);
+  ASSERT_EQUAL(resource.upstream_resource(), &upstream);
+
+  const std::size_t sizes[] = {1, 2, 3, 4, 5, 100, 128, 129, 4096};
+  for (std::size_t size : sizes)
+  {
+    resource.do_deallocate(resource.do_allocate(size), size);
+  }
+
+  thrust::mr::allocation_statistics stats = resource.get_stats();
+  ASSERT_EQUAL(stats.size_histogram[0], 1u);
+  ASSERT_EQUAL(stats.size_histogram[1], 1u);
+  ASSERT_EQUAL(stats.size_histogram[2], 2u);
+  ASSERT_EQUAL(stats.size_histogram[3], 1u);
+  ASSERT_EQUAL(stats.size_histogram[7], 2u);
+  ASSERT_EQUAL(stats.size_histogram[8], 1u);
+  ASSERT_EQUAL(stats.size_histogram[12], 1u);
+
+  resource.reset_stats();
+  ASSERT_EQUAL(resource.get_stats().size_histogram[7], 0u);
+}
+DECLARE_UNITTEST(TestStatisticsResourceHistogram);
+
+void TestStatisticsResourceTraceHook()
+{
+  statistics_resource resource;
+
+  std::vector<thrust::mr::allocation_event> events;
+  resource.set_trace_hook([&](const thrust::mr::allocation_event& event) {
+    events.push_back(event);
+  });
+
+  void* p                     = resource.do_allocate(256, 32);
+  const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(p);
+  resource.do_deallocate(p, 256, 32);
+
+  ASSERT_EQUAL(events.size(), 2u);
+  ASSERT_EQUAL(events[0].kind == thrust::mr::allocation_event_kind::allocate, true);
+  ASSERT_EQUAL(events[1].kind == thrust::mr::allocation_event_kind::deallocate, true);
+  for (const thrust::mr::allocation_event& event : events)
+  {
+    ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(event.pointer), address);
+    ASSERT_EQUAL(event.bytes, 256u);
+    ASSERT_EQUAL(event.alignment, 32u);
+  }
+
+  // an empty hook stops tracing
+  resource.set_trace_hook(statistics_resource::trace_hook());
+  resource.do_deallocate(resource.do_allocate(16), 16);
+  ASSERT_EQUAL(events.size(), 2u);
+}
+DECLARE_UNITTEST(TestStatisticsResourceTraceHook);
+
+void TestStatisticsResourceConcurrent()
+{
+  statistics_resource resource(true);
+
+  const std::size_t num_threads = 4;
+  const std::size_t num_allocs  = 1000;
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&] {
+      for (std::size_t i = 0; i < num_allocs; ++i)
+      {
+        resource.do_deallocate(resource.do_allocate(64), 64);
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  thrust::mr::allocation_statistics stats = resource.get_stats();
+  ASSERT_EQUAL(stats.allocations, num_threads * num_allocs);
+  ASSERT_EQUAL(stats.deallocations, num_threads * num_allocs);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.size_histogram[6], num_threads * num_allocs);
+  ASSERT_LESS(stats.peak_bytes_in_use, num_threads * 64 + 1);
+}
+DECLARE_UNITTEST(TestStatisticsResourceConcurrent);
+
+void TestStatisticsResourceWithAllocator()
+{
+  statistics_resource resource;
+
+  {
+    thrust::mr::allocator<int, statistics_resource> alloc(&resource);
+    thrust::host_vector<int, thrust::mr::allocator<int, statistics_resource>> v(1000, 1, alloc);
+
+    ASSERT_EQUAL(resource.get_stats().bytes_in_use, 1000 * sizeof(int));
+  }
+
+  ASSERT_EQUAL(resource.get_stats().allocations, 1u);
+  ASSERT_EQUAL(resource.get_stats().bytes_in_use, 0u);
+}
+DECLARE_UNITTEST(TestStatisticsResourceWithAllocator);
@@ -0,0 +1,161 @@
+#include <thrust/partition.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/unique.h>
+
+#include <unittest/unittest.h>
+
+// holds for the first keep positions of every period positions. periods which
+// are longer than a tile leave some tiles with everything and others with
+// nothing
+struct in_band
+{
+  int period;
+  int keep;
+
+  _CCCL_HOST_DEVICE bool operator()(int x) const
+  {
+    return x % period < keep;
+  }
+};
+
+// every position outside the band repeats the value before it
+thrust::host_vector<int> runs_outside_band(int n, in_band band)
+{
+  thrust::host_vector<int> result(n);
+
+  for (int i = 0; i < n; ++i)
+  {
+    result[i] = (i == 0 || band(i)) ? i : result[i - 1];
+  }
+
+  return result;
+}
+
+template <typename Policy>
+void check_compaction(Policy policy, int n, in_band band)
+{
+  thrust::host_vector<int> h_positions(n);
+  thrust::sequence(h_positions.begin(), h_positions.end());
+
+  {
+    thrust::host_vector<int> h_data   = h_positions;
+    thrust::device_vector<int> d_data = h_positions;
+
+    size_t h_size = thrust::remove_if(h_data.begin(), h_data.end(), band) - h_data.begin();
+    size_t d_size = thrust::remove_if(policy, d_data.begin(), d_data.end(), band) - d_data.begin();
+
+    ASSERT_EQUAL(h_size, d_size);
+    h_data.resize(h_size);
+    d_data.resize(d_size);
+    ASSERT_EQUAL(h_data, d_data);
+  }
+
+  {
+    thrust::host_vector<int> h_data      = h_positions;
+    thrust::device_vector<int> d_data    = h_positions;
+    thrust::device_vector<int> d_stencil = h_positions;
+
+    size_t h_size = thrust::remove_if(h_data.begin(), h_data.end(), h_positions.begin(), band) - h_data.begin();
+    size_t d_size =
+      thrust::remove_if(policy, d_data.begin(), d_data.end(), d_stencil.begin(), band) - d_data.begin();
+
+    ASSERT_EQUAL(h_size, d_size);
+    h_data.resize(h_size);
+    d_data.resize(d_size);
+    ASSERT_EQUAL(h_data, d_data);
+  }
+
+  {
+    thrust::host_vector<int> h_data   = h_positions;
+    thrust::device_vector<int> d_data = h_positions;
+
+    size_t h_size = thrust::stable_partition(h_data.begin(), h_data.end(), band) - h_data.begin();
+    size_t d_size = thrust::stable_partition(policy, d_data.begin(), d_data.end(), band) - d_data.begin();
+
+    ASSERT_EQUAL(h_size, d_size);
+    ASSERT_EQUAL(h_data, d_data);
+  }
+
+  {
+    thrust::host_vector<int> h_data      = h_positions;
+    thrust::device_vector<int> d_data    = h_positions;
+    thrust::device_vector<int> d_stencil = h_positions;
+
+    size_t h_size =
+      thrust::stable_partition(h_data.begin(), h_data.end(), h_positions.begin(), band) - h_data.begin();
+    size_t d_size =
+      thrust::stable_partition(policy, d_data.begin(), d_data.end(), d_stencil.begin(), band) - d_data.begin();
+
+    ASSERT_EQUAL(h_size, d_size);
+    ASSERT_EQUAL(h_data, d_data);
+  }
+
+  {
+    thrust::host_vector<int> h_keys   = runs_outside_band(n, band);
+    thrust::device_vector<int> d_keys = h_keys;
+
+    size_t h_size = thrust::unique(h_keys.begin(), h_keys.end()) - h_keys.begin();
+    size_t d_size = thrust::unique(policy, d_keys.begin(), d_keys.end()) - d_keys.begin();
+
+    ASSERT_EQUAL(h_size, d_size);
+    h_keys.resize(h_size);
+    d_keys.resize(d_size);
+    ASSERT_EQUAL(h_keys, d_keys);
+  }
+
+  {
+    thrust::host_vector<int> h_keys     = runs_outside_band(n, band);
+    thrust::host_vector<int> h_values   = h_positions;
+    thrust::device_vector<int> d_keys   = h_keys;
+    thrust::device_vector<int> d_values = h_values;
+
+    size_t h_size = thrust::unique_by_key(h_keys.begin(), h_keys.end(), h_values.begin()).first - h_keys.begin();
+    size_t d_size =
+      thrust::unique_by_key(policy, d_keys.begin(), d_keys.end(), d_values.begin()).first - d_keys.begin();
+
+    ASSERT_EQUAL(h_size, d_size);
+    h_keys.resize(h_size);
+    h_values.resize(h_size);
+    d_keys.resize(d_size);
+    d_values.resize(d_size);
+    ASSERT_EQUAL(h_keys, d_keys);
+    ASSERT_EQUAL(h_values, d_values);
+  }
+}
+
+template <typename Policy>
+void check_compaction_ratios(Policy policy, int n)
+{
+  const in_band bands[] = {
+    {2, 1},                  // every other element
+    {1000, 3},               // sparse
+    {1000, 997},             // dense
+    {n, n / 7},              // only the first tiles
+    {n, n - n / 7},          // all but the last tiles
+    {n / 5 + 1, n / 10 + 1}, // long bands which straddle tiles
+    {n, 0},                  // none
+    {n, n}                   // all
+  };
+
+  for (const in_band& band : bands)
+  {
+    check_compaction(policy, n, band);
+  }
+}
+
+void TestOmpCompactionManyTiles()
+{
+  const int sizes[] = {1, 1000, (1 << 17) + 11, 1 << 20};
+
+  for (int n : sizes)
+  {
+    // one tile per thread, more tiles than processors
+    check_compaction_ratios(thrust::omp::par.num_threads(64), n);
+
+    // several tiles per thread, with a number of tiles which is not a power of two
+    check_compaction_ratios(thrust::omp::par.num_threads(7).schedule(thrust::omp::schedule_dynamic), n);
+  }
+}
+DECLARE_UNITTEST(TestOmpCompactionManyTiles);
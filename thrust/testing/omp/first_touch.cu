@@ -0,0 +1,82 @@
+#include <thrust/host_vector.h>
+#include <thrust/system/omp/memory.h>
+#include <thrust/system/omp/numa_memory_resource.h>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+// records the thread that constructed it, and so first touched its memory
+struct touched_by
+{
+  int thread;
+
+  touched_by()
+      : thread(omp_get_thread_num())
+  {}
+
+  touched_by(const touched_by&)
+      : thread(omp_get_thread_num())
+  {}
+
+  touched_by& operator=(const touched_by&) = default;
+};
+
+void CheckStaticDecomposition(const touched_by* v, std::size_t first, std::size_t last, int num_threads)
+{
+  // a static schedule hands every thread one contiguous block, in the order of the thread numbers
+  ASSERT_EQUAL(v[first].thread, 0);
+  ASSERT_EQUAL(v[last - 1].thread, num_threads - 1);
+  for (std::size_t i = first + 1; i < last; ++i)
+  {
+    ASSERT_EQUAL(v[i - 1].thread <= v[i].thread, true);
+  }
+}
+
+template <typename Allocator>
+void TestFirstTouch()
+{
+  const int num_threads = 4;
+  const std::size_t n   = 1 << 16;
+
+  const int previous_max_threads = omp_get_max_threads();
+  omp_set_num_threads(num_threads);
+
+  // the runtime may hand out a smaller team, e.g. under OMP_DYNAMIC or OMP_THREAD_LIMIT, which would spread the
+  // elements differently
+  int team_size = 0;
+#pragma omp parallel
+  {
+#pragma omp single
+    team_size = omp_get_num_threads();
+  }
+
+  if (team_size != num_threads)
+  {
+    omp_set_num_threads(previous_max_threads);
+    return;
+  }
+
+  thrust::host_vector<touched_by, Allocator> v(n);
+  CheckStaticDecomposition(thrust::raw_pointer_cast(v.data()), 0, n, num_threads);
+
+  // growing moves the existing elements and constructs the new ones in parallel too
+  v.resize(2 * n);
+  CheckStaticDecomposition(thrust::raw_pointer_cast(v.data()), 0, n, num_threads);
+  CheckStaticDecomposition(thrust::raw_pointer_cast(v.data()), n, 2 * n, num_threads);
+
+  omp_set_num_threads(previous_max_threads);
+}
+
+void TestOmpAllocatorFirstTouch()
+{
+  TestFirstTouch<thrust::omp::allocator<touched_by>>();
+}
+DECLARE_UNITTEST(TestOmpAllocatorFirstTouch);
+
+#if defined(__linux__)
+void TestOmpNumaAllocatorFirstTouch()
+{
+  TestFirstTouch<thrust::omp::numa_allocator<touched_by>>();
+}
+DECLARE_UNITTEST(TestOmpNumaAllocatorFirstTouch);
+#endif // __linux__
@@ -0,0 +1,71 @@
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <memory>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+struct record_team_size
+{
+  void operator()(int& x) const
+  {
+    x = omp_get_num_threads();
+  }
+};
+
+void TestOmpParNumThreads()
+{
+  thrust::device_vector<int> team_sizes(1000, 0);
+
+  thrust::for_each(thrust::omp::par.num_threads(2), team_sizes.begin(), team_sizes.end(), record_team_size());
+
+  ASSERT_EQUAL(thrust::reduce(team_sizes.begin(), team_sizes.end(), 0, thrust::maximum<int>()) <= 2, true);
+  ASSERT_EQUAL(thrust::reduce(team_sizes.begin(), team_sizes.end(), 2, thrust::minimum<int>()) >= 1, true);
+}
+DECLARE_UNITTEST(TestOmpParNumThreads);
+
+template <typename Policy, typename T>
+void check_algorithms(Policy policy, const thrust::host_vector<T>& h_data)
+{
+  thrust::device_vector<T> d_data = h_data;
+
+  ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end()), thrust::reduce(policy, d_data.begin(), d_data.end()));
+
+  thrust::host_vector<T> h_result(h_data.size());
+  thrust::device_vector<T> d_result(d_data.size());
+
+  thrust::inclusive_scan(h_data.begin(), h_data.end(), h_result.begin());
+  thrust::inclusive_scan(policy, d_data.begin(), d_data.end(), d_result.begin());
+  ASSERT_EQUAL(h_result, d_result);
+
+  thrust::copy(policy, d_data.begin(), d_data.end(), d_result.begin());
+  ASSERT_EQUAL(h_data, d_result);
+
+  thrust::host_vector<T> h_sorted = h_data;
+  thrust::stable_sort(h_sorted.begin(), h_sorted.end());
+  thrust::stable_sort(policy, d_data.begin(), d_data.end());
+  ASSERT_EQUAL(h_sorted, d_data);
+}
+
+template <typename T>
+struct TestOmpParConfig
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+    check_algorithms(thrust::omp::par.num_threads(3), h_data);
+    check_algorithms(thrust::omp::par.schedule(thrust::omp::schedule_dynamic).grain(100), h_data);
+    check_algorithms(thrust::omp::par.grain(n + 1), h_data);
+    check_algorithms(thrust::omp::par.num_threads(2).schedule(thrust::omp::schedule_guided), h_data);
+    check_algorithms(thrust::omp::par(std::allocator<char>()).num_threads(2).grain(16), h_data);
+  }
+};
+VariableUnitTest<TestOmpParConfig, IntegralTypes> TestOmpParConfigInstance;
@@ -146,6 +146,107 @@ struct TestReduceWithOperator
 };
 VariableUnitTest<TestReduceWithOperator, UnsignedIntegralTypes> TestReduceWithOperatorInstance;
 
+template <typename T, typename BinaryFunction>
+T reduce_in_order(const thrust::host_vector<T>& data, T init, BinaryFunction binary_op)
+{
+  for (size_t i = 0; i < data.size(); i++)
+  {
+    init = binary_op(init, data[i]);
+  }
+
+  return init;
+}
+
+template <typename T>
+struct TestReduceReassociableOperators
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d_data = h_data;
+
+    T init = h_data.empty() ? T(0) : h_data[0];
+
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::minimum<T>()),
+                 thrust::reduce(h_data.begin(), h_data.end(), init, thrust::minimum<T>()));
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::maximum<T>()),
+                 thrust::reduce(d_data.begin(), d_data.end(), init, thrust::maximum<T>()));
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::bit_xor<T>()),
+                 thrust::reduce(h_data.begin(), h_data.end(), init, thrust::bit_xor<T>()));
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::bit_or<T>()),
+                 thrust::reduce(d_data.begin(), d_data.end(), init, thrust::bit_or<>()));
+  }
+};
+VariableUnitTest<TestReduceReassociableOperators, IntegralTypes> TestReduceReassociableOperatorsInstance;
+
+template <typename T>
+struct TestReducePlusWraparound
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d_data = h_data;
+
+    T init = 13;
+
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::plus<T>()),
+                 thrust::reduce(h_data.begin(), h_data.end(), init, thrust::plus<T>()));
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::plus<T>()),
+                 thrust::reduce(d_data.begin(), d_data.end(), init, thrust::plus<T>()));
+  }
+};
+VariableUnitTest<TestReducePlusWraparound, UnsignedIntegralTypes> TestReducePlusWraparoundInstance;
+
+template <typename T>
+struct TestReduceSignedPartialSumsOverflow
+{
+  void operator()(const size_t n)
+  {
+    // the sum in order stays within range, but every other element is large and
+    // of the same sign, so some partial sums out of order do not
+    const T large = std::numeric_limits<T>::max() / 4;
+
+    thrust::host_vector<T> h_data(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      h_data[i] = (i % 2 == 0) ? large : T(-large);
+    }
+    thrust::device_vector<T> d_data = h_data;
+
+    T init = 13;
+
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::plus<T>()),
+                 thrust::reduce(h_data.begin(), h_data.end(), init, thrust::plus<T>()));
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::plus<T>()),
+                 thrust::reduce(d_data.begin(), d_data.end(), init, thrust::plus<T>()));
+  }
+};
+VariableUnitTest<TestReduceSignedPartialSumsOverflow, unittest::type_list<int, long, long long>>
+  TestReduceSignedPartialSumsOverflowInstance;
+
+template <typename T>
+struct TestReduceExactFloatingPoint
+{
+  void operator()(const size_t n)
+  {
+    // small integers are summed exactly in any order
+    thrust::host_vector<T> h_data(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      h_data[i] = static_cast<T>(static_cast<int>(i % 7) - 3);
+    }
+    thrust::device_vector<T> d_data = h_data;
+
+    T init = 0.5;
+
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::plus<T>()), thrust::reduce(h_data.begin(), h_data.end(), init));
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::plus<T>()), thrust::reduce(d_data.begin(), d_data.end(), init));
+    ASSERT_EQUAL(reduce_in_order(h_data, init, thrust::maximum<T>()),
+                 thrust::reduce(d_data.begin(), d_data.end(), init, thrust::maximum<T>()));
+  }
+};
+VariableUnitTest<TestReduceExactFloatingPoint, FloatingPointTypes> TestReduceExactFloatingPointInstance;
+
 template <typename T>
 struct plus_mod3
 {
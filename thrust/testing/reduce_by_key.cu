@@ -213,6 +213,52 @@ struct TestReduceByKeyToDiscardIterator
 };
 VariableUnitTest<TestReduceByKeyToDiscardIterator, IntegralTypes> TestReduceByKeyToDiscardIteratorInstance;
 
+template <typename K>
+struct TestReduceByKeyLongSegments
+{
+  void operator()(const size_t n)
+  {
+    using V = unsigned int; // ValueType
+
+    // a few segments, each long enough to span several blocks of a parallel backend
+    thrust::host_vector<K> h_keys(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      h_keys[i] = static_cast<K>(i / (n / 3 + 1));
+    }
+
+    thrust::host_vector<V> h_vals   = unittest::random_integers<V>(n);
+    thrust::device_vector<K> d_keys = h_keys;
+    thrust::device_vector<V> d_vals = h_vals;
+
+    thrust::host_vector<K> h_keys_output(n);
+    thrust::host_vector<V> h_vals_output(n);
+    thrust::device_vector<K> d_keys_output(n);
+    thrust::device_vector<V> d_vals_output(n);
+
+    size_t h_size =
+      thrust::reduce_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_keys_output.begin(), h_vals_output.begin())
+        .first
+      - h_keys_output.begin();
+
+    size_t d_size =
+      thrust::reduce_by_key(d_keys.begin(), d_keys.end(), d_vals.begin(), d_keys_output.begin(), d_vals_output.begin())
+        .first
+      - d_keys_output.begin();
+
+    ASSERT_EQUAL(h_size, d_size);
+
+    h_keys_output.resize(h_size);
+    h_vals_output.resize(h_size);
+    d_keys_output.resize(d_size);
+    d_vals_output.resize(d_size);
+
+    ASSERT_EQUAL(h_keys_output, d_keys_output);
+    ASSERT_EQUAL(h_vals_output, d_vals_output);
+  }
+};
+VariableUnitTest<TestReduceByKeyLongSegments, IntegralTypes> TestReduceByKeyLongSegmentsInstance;
+
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator1, typename OutputIterator2>
 thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   my_system& system,
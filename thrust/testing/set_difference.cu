@@ -4,6 +4,9 @@
 #include <thrust/set_operations.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
+#include <unittest/skewed_inputs.h>
 #include <unittest/unittest.h>
 
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
@@ -117,6 +120,20 @@ void TestSetDifference(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestSetDifference);
 
+template <typename T>
+void TestSetDifferenceSkewed(const size_t n)
+{
+  unittest::check_skewed_inputs<T>(
+    n,
+    [](auto... args) {
+      return std::set_difference(args...);
+    },
+    [](auto... args) {
+      return thrust::set_difference(args...);
+    });
+}
+DECLARE_VARIABLE_UNITTEST(TestSetDifferenceSkewed);
+
 template <typename T>
 void TestSetDifferenceEquivalentRanges(const size_t n)
 {
@@ -5,6 +5,9 @@
 #include <thrust/set_operations.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
+#include <unittest/skewed_inputs.h>
 #include <unittest/unittest.h>
 
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
@@ -116,6 +119,20 @@ void TestSetIntersection(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestSetIntersection);
 
+template <typename T>
+void TestSetIntersectionSkewed(const size_t n)
+{
+  unittest::check_skewed_inputs<T>(
+    n,
+    [](auto... args) {
+      return std::set_intersection(args...);
+    },
+    [](auto... args) {
+      return thrust::set_intersection(args...);
+    });
+}
+DECLARE_VARIABLE_UNITTEST(TestSetIntersectionSkewed);
+
 template <typename T>
 void TestSetIntersectionToDiscardIterator(const size_t n)
 {
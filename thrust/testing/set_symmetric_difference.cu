@@ -4,6 +4,9 @@
 #include <thrust/set_operations.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
+#include <unittest/skewed_inputs.h>
 #include <unittest/unittest.h>
 
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
@@ -111,6 +114,20 @@ void TestSetSymmetricDifference(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestSetSymmetricDifference);
 
+template <typename T>
+void TestSetSymmetricDifferenceSkewed(const size_t n)
+{
+  unittest::check_skewed_inputs<T>(
+    n,
+    [](auto... args) {
+      return std::set_symmetric_difference(args...);
+    },
+    [](auto... args) {
+      return thrust::set_symmetric_difference(args...);
+    });
+}
+DECLARE_VARIABLE_UNITTEST(TestSetSymmetricDifferenceSkewed);
+
 template <typename T>
 void TestSetSymmetricDifferenceEquivalentRanges(const size_t n)
 {
@@ -5,6 +5,9 @@
 #include <thrust/set_operations.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
+#include <unittest/skewed_inputs.h>
 #include <unittest/unittest.h>
 
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
@@ -150,6 +153,20 @@ void TestSetUnion(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestSetUnion);
 
+template <typename T>
+void TestSetUnionSkewed(const size_t n)
+{
+  unittest::check_skewed_inputs<T>(
+    n,
+    [](auto... args) {
+      return std::set_union(args...);
+    },
+    [](auto... args) {
+      return thrust::set_union(args...);
+    });
+}
+DECLARE_VARIABLE_UNITTEST(TestSetUnionSkewed);
+
 template <typename T>
 void TestSetUnionToDiscardIterator(const size_t n)
 {
@@ -2,6 +2,11 @@
 #include <thrust/iterator/retag.h>
 #include <thrust/sort.h>
 
+#include <cuda/std/tuple>
+
+#include <algorithm>
+#include <functional>
+
 #include <unittest/unittest.h>
 
 template <typename RandomAccessIterator>
@@ -127,3 +132,146 @@ void TestSortBoolDescending()
   ASSERT_EQUAL(h_data, d_data);
 }
 DECLARE_UNITTEST(TestSortBoolDescending);
+
+// a comparator other than less or greater, so that primitive keys take the comparison sort
+template <typename T>
+struct custom_less
+{
+  _CCCL_HOST_DEVICE bool operator()(const T& lhs, const T& rhs) const
+  {
+    return lhs < rhs;
+  }
+};
+
+template <typename T>
+void TestSortCustomComparatorPatterns(const size_t n)
+{
+  const thrust::host_vector<T> h_random = unittest::random_integers<T>(n);
+
+  // random, sorted, reversed, few distinct and all equal keys
+  for (int pattern = 0; pattern < 5; ++pattern)
+  {
+    thrust::host_vector<T> h_data = h_random;
+
+    if (pattern == 1)
+    {
+      std::sort(h_data.begin(), h_data.end());
+    }
+    else if (pattern == 2)
+    {
+      std::sort(h_data.begin(), h_data.end(), std::greater<T>());
+    }
+    else if (pattern == 3)
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        h_data[i] = T(i % 4);
+      }
+    }
+    else if (pattern == 4)
+    {
+      thrust::fill(h_data.begin(), h_data.end(), T(7));
+    }
+
+    thrust::host_vector<T> h_expected = h_data;
+    std::sort(h_expected.begin(), h_expected.end());
+
+    thrust::device_vector<T> d_data = h_data;
+
+    thrust::sort(h_data.begin(), h_data.end(), custom_less<T>());
+    thrust::sort(d_data.begin(), d_data.end(), custom_less<T>());
+
+    ASSERT_EQUAL(h_data, h_expected);
+    ASSERT_EQUAL(d_data, h_expected);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestSortCustomComparatorPatterns);
+
+struct key_with_payload
+{
+  int key;
+  int payload;
+};
+
+struct key_with_payload_less
+{
+  _CCCL_HOST_DEVICE bool operator()(const key_with_payload& lhs, const key_with_payload& rhs) const
+  {
+    return lhs.key < rhs.key;
+  }
+};
+
+void TestSortLargeStructKeys()
+{
+  // large enough for the parallel sorts of the host systems
+  const size_t n = 300007;
+
+  thrust::host_vector<int> h_keys = unittest::random_integers<int>(n);
+
+  thrust::host_vector<key_with_payload> h_data(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_data[i].key     = h_keys[i] % 1000;
+    h_data[i].payload = 3 * h_data[i].key + 1;
+  }
+
+  thrust::device_vector<key_with_payload> d_data = h_data;
+
+  thrust::sort(h_data.begin(), h_data.end(), key_with_payload_less());
+  thrust::sort(d_data.begin(), d_data.end(), key_with_payload_less());
+
+  thrust::host_vector<key_with_payload> h_result = d_data;
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] %= 1000;
+  }
+  std::sort(h_keys.begin(), h_keys.end());
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(h_data[i].key, h_keys[i]);
+    ASSERT_EQUAL(h_data[i].payload, 3 * h_keys[i] + 1);
+    ASSERT_EQUAL(h_result[i].key, h_keys[i]);
+    ASSERT_EQUAL(h_result[i].payload, 3 * h_keys[i] + 1);
+  }
+}
+DECLARE_UNITTEST(TestSortLargeStructKeys);
+
+struct key_with_payload_decomposer
+{
+  _CCCL_HOST_DEVICE cuda::std::tuple<int&> operator()(key_with_payload& k) const
+  {
+    return cuda::std::tuple<int&>(k.key);
+  }
+};
+
+void TestSortDecomposer(const size_t n)
+{
+  thrust::host_vector<int> h_keys = unittest::random_integers<int>(n);
+
+  thrust::host_vector<key_with_payload> h_data(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_data[i].key     = h_keys[i];
+    h_data[i].payload = h_keys[i] / 2;
+  }
+
+  thrust::device_vector<key_with_payload> d_data = h_data;
+
+  thrust::sort(h_data.begin(), h_data.end(), thrust::make_decomposer_greater(key_with_payload_decomposer()));
+  thrust::sort(d_data.begin(), d_data.end(), thrust::make_decomposer_greater(key_with_payload_decomposer()));
+
+  thrust::host_vector<key_with_payload> h_result = d_data;
+
+  std::sort(h_keys.begin(), h_keys.end(), std::greater<int>());
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(h_data[i].key, h_keys[i]);
+    ASSERT_EQUAL(h_data[i].payload, h_keys[i] / 2);
+    ASSERT_EQUAL(h_result[i].key, h_keys[i]);
+    ASSERT_EQUAL(h_result[i].payload, h_keys[i] / 2);
+  }
+}
+DECLARE_SIZED_UNITTEST(TestSortDecomposer);
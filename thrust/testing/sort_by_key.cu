@@ -1,5 +1,6 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 
 #include <unittest/unittest.h>
@@ -149,3 +150,42 @@ void TestSortByKeyBoolDescending()
   ASSERT_EQUAL(h_values, d_values);
 }
 DECLARE_UNITTEST(TestSortByKeyBoolDescending);
+
+// a comparator other than less or greater, so that primitive keys take the comparison sort
+template <typename T>
+struct custom_greater
+{
+  _CCCL_HOST_DEVICE bool operator()(const T& lhs, const T& rhs) const
+  {
+    return lhs > rhs;
+  }
+};
+
+template <typename T>
+void TestSortByKeyCustomComparator(const size_t n)
+{
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+
+  // the values record where every key came from, since equal keys may be reordered
+  thrust::host_vector<int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+
+  thrust::device_vector<T> d_keys     = h_keys;
+  thrust::device_vector<int> d_values = h_values;
+
+  const thrust::host_vector<T> h_original = h_keys;
+
+  thrust::sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), custom_greater<T>());
+  thrust::sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), custom_greater<T>());
+
+  ASSERT_EQUAL(thrust::is_sorted(h_keys.begin(), h_keys.end(), thrust::greater<T>()), true);
+  ASSERT_EQUAL(h_keys, d_keys);
+
+  thrust::host_vector<int> h_result = d_values;
+  for (size_t i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(h_original[h_values[i]], h_keys[i]);
+    ASSERT_EQUAL(h_original[h_result[i]], h_keys[i]);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestSortByKeyCustomComparator);
@@ -1,6 +1,7 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
 
 #include <unittest/unittest.h>
 
@@ -104,6 +105,24 @@ struct TestStableSort
 };
 VariableUnitTest<TestStableSort, SignedIntegralTypes> TestStableSortInstance;
 
+template <typename T>
+struct TestStableSortDescending
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d_data = h_data;
+
+    thrust::stable_sort(h_data.begin(), h_data.end(), thrust::greater<T>());
+    thrust::stable_sort(d_data.begin(), d_data.end(), thrust::greater<T>());
+
+    ASSERT_EQUAL(h_data, d_data);
+  }
+};
+VariableUnitTest<TestStableSortDescending,
+                 unittest::type_list<char, unsigned short, int, unsigned long long, float, double>>
+  TestStableSortDescendingInstance;
+
 template <typename T>
 struct TestStableSortSemantics
 {
@@ -121,6 +140,26 @@ struct TestStableSortSemantics
 VariableUnitTest<TestStableSortSemantics, unittest::type_list<unittest::int8_t, unittest::int16_t, unittest::int32_t>>
   TestStableSortSemanticsInstance;
 
+// keys-only sorts only use the in-place radix sort when a temporary copy of the keys would exceed 1 GiB, so it is
+// tested directly
+template <typename T>
+struct TestStableSortInPlaceRadixSort
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+    thrust::host_vector<T> h_ref  = h_data;
+
+    thrust::stable_sort(h_ref.begin(), h_ref.end());
+    thrust::system::detail::sequential::radix_sort_detail::in_place_radix_sort(h_data.begin(), n, 8 * sizeof(T) - 8);
+
+    ASSERT_EQUAL(h_ref, h_data);
+  }
+};
+VariableUnitTest<TestStableSortInPlaceRadixSort,
+                 unittest::type_list<char, unsigned short, int, unsigned long long, float, double>>
+  TestStableSortInPlaceRadixSortInstance;
+
 template <typename T>
 struct comp_mod3
 {
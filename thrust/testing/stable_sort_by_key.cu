@@ -1,7 +1,10 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <cuda/std/tuple>
+
 #include <unittest/unittest.h>
 
 template <typename RandomAccessIterator1, typename RandomAccessIterator2>
@@ -115,6 +118,29 @@ struct TestStableSortByKey
 };
 VariableUnitTest<TestStableSortByKey, SignedIntegralTypes> TestStableSortByKeyInstance;
 
+template <typename T>
+struct TestStableSortByKeyDescending
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_keys   = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d_keys = h_keys;
+
+    thrust::host_vector<unsigned int> h_values(n);
+    thrust::sequence(h_values.begin(), h_values.end());
+    thrust::device_vector<unsigned int> d_values = h_values;
+
+    thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), thrust::greater<T>());
+    thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), thrust::greater<T>());
+
+    ASSERT_EQUAL(h_keys, d_keys);
+    ASSERT_EQUAL(h_values, d_values);
+  }
+};
+VariableUnitTest<TestStableSortByKeyDescending,
+                 unittest::type_list<signed char, short, unsigned int, long, float, double>>
+  TestStableSortByKeyDescendingInstance;
+
 template <typename T>
 struct TestStableSortByKeySemantics
 {
@@ -136,3 +162,129 @@ struct TestStableSortByKeySemantics
 VariableUnitTest<TestStableSortByKeySemantics,
                  unittest::type_list<unittest::uint8_t, unittest::uint16_t, unittest::uint32_t>>
   TestStableSortByKeySemanticsInstance;
+
+// a comparator other than less, so that the reference sort is a merge sort rather than a radix sort
+template <typename T>
+struct merge_sort_less
+{
+  _CCCL_HOST_DEVICE bool operator()(const T& lhs, const T& rhs) const
+  {
+    return lhs < rhs;
+  }
+};
+
+template <typename T>
+struct TestStableSortByKeyDuplicateKeys
+{
+  void operator()(const size_t n)
+  {
+    // few distinct keys, so that the values tell whether every radix pass kept equal keys in order
+    thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      h_keys[i] = h_keys[i] / T(64);
+    }
+    thrust::device_vector<T> d_keys = h_keys;
+
+    thrust::host_vector<unsigned int> h_values(n);
+    thrust::sequence(h_values.begin(), h_values.end());
+    thrust::device_vector<unsigned int> d_values = h_values;
+
+    thrust::host_vector<T> h_ref_keys              = h_keys;
+    thrust::host_vector<unsigned int> h_ref_values = h_values;
+
+    thrust::stable_sort_by_key(h_ref_keys.begin(), h_ref_keys.end(), h_ref_values.begin(), merge_sort_less<T>());
+    thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin());
+    thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin());
+
+    ASSERT_EQUAL(h_ref_keys, h_keys);
+    ASSERT_EQUAL(h_ref_values, h_values);
+    ASSERT_EQUAL(h_ref_keys, d_keys);
+    ASSERT_EQUAL(h_ref_values, d_values);
+  }
+};
+VariableUnitTest<TestStableSortByKeyDuplicateKeys,
+                 unittest::type_list<unittest::int32_t, unittest::uint32_t, unittest::int64_t, float, double>>
+  TestStableSortByKeyDuplicateKeysInstance;
+
+struct tenant_record
+{
+  unsigned int tenant;
+  long long timestamp;
+};
+
+struct tenant_record_decomposer
+{
+  _CCCL_HOST_DEVICE cuda::std::tuple<unsigned int&, long long&> operator()(tenant_record& r) const
+  {
+    return {r.tenant, r.timestamp};
+  }
+};
+
+struct tenant_record_less
+{
+  _CCCL_HOST_DEVICE bool operator()(const tenant_record& lhs, const tenant_record& rhs) const
+  {
+    return lhs.tenant < rhs.tenant || (lhs.tenant == rhs.tenant && lhs.timestamp < rhs.timestamp);
+  }
+};
+
+struct tenant_record_greater
+{
+  _CCCL_HOST_DEVICE bool operator()(const tenant_record& lhs, const tenant_record& rhs) const
+  {
+    return tenant_record_less()(rhs, lhs);
+  }
+};
+
+template <typename Decomposed, typename Reference>
+void TestStableSortByKeyDecomposer(const size_t n)
+{
+  thrust::host_vector<unsigned int> h_tenants = unittest::random_integers<unsigned int>(n);
+  thrust::host_vector<int> h_timestamps       = unittest::random_integers<int>(n);
+
+  // few distinct keys, including negative timestamps, so that the values tell whether the sort is stable
+  thrust::host_vector<tenant_record> h_keys(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    h_keys[i].tenant    = h_tenants[i] % 16;
+    h_keys[i].timestamp = static_cast<long long>(h_timestamps[i] % 64) << 20;
+  }
+  thrust::device_vector<tenant_record> d_keys = h_keys;
+
+  thrust::host_vector<unsigned int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+  thrust::device_vector<unsigned int> d_values = h_values;
+
+  thrust::host_vector<tenant_record> h_ref_keys  = h_keys;
+  thrust::host_vector<unsigned int> h_ref_values = h_values;
+
+  thrust::stable_sort_by_key(h_ref_keys.begin(), h_ref_keys.end(), h_ref_values.begin(), Reference());
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), Decomposed());
+  thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), Decomposed());
+
+  thrust::host_vector<tenant_record> h_result = d_keys;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    ASSERT_EQUAL(h_keys[i].tenant, h_ref_keys[i].tenant);
+    ASSERT_EQUAL(h_keys[i].timestamp, h_ref_keys[i].timestamp);
+    ASSERT_EQUAL(h_result[i].tenant, h_ref_keys[i].tenant);
+    ASSERT_EQUAL(h_result[i].timestamp, h_ref_keys[i].timestamp);
+  }
+
+  ASSERT_EQUAL(h_values, h_ref_values);
+  ASSERT_EQUAL(d_values, h_ref_values);
+}
+
+void TestStableSortByKeyDecomposerLess(const size_t n)
+{
+  TestStableSortByKeyDecomposer<thrust::decomposer_less<tenant_record_decomposer>, tenant_record_less>(n);
+}
+DECLARE_SIZED_UNITTEST(TestStableSortByKeyDecomposerLess);
+
+void TestStableSortByKeyDecomposerGreater(const size_t n)
+{
+  TestStableSortByKeyDecomposer<thrust::decomposer_greater<tenant_record_decomposer>, tenant_record_greater>(n);
+}
+DECLARE_SIZED_UNITTEST(TestStableSortByKeyDecomposerGreater);
@@ -0,0 +1,139 @@
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <memory>
+
+#include <tbb/task_arena.h>
+#include <unittest/unittest.h>
+
+struct record_arena_concurrency
+{
+  void operator()(int& x) const
+  {
+    x = ::tbb::this_task_arena::max_concurrency();
+  }
+};
+
+void TestTbbParArena()
+{
+  ::tbb::task_arena arena(2);
+
+  thrust::device_vector<int> concurrencies(1000, 0);
+
+  thrust::for_each(thrust::tbb::par.on(arena), concurrencies.begin(), concurrencies.end(), record_arena_concurrency());
+
+  ASSERT_EQUAL(thrust::count(concurrencies.begin(), concurrencies.end(), 2), 1000);
+}
+DECLARE_UNITTEST(TestTbbParArena);
+
+template <typename T>
+struct is_even
+{
+  bool operator()(T x) const
+  {
+    return x % 2 == 0;
+  }
+};
+
+template <typename Policy, typename T>
+void check_algorithms(Policy policy, const thrust::host_vector<T>& h_data)
+{
+  const thrust::device_vector<T> d_original = h_data;
+  thrust::device_vector<T> d_data           = h_data;
+
+  ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end()), thrust::reduce(policy, d_data.begin(), d_data.end()));
+
+  thrust::host_vector<T> h_result(h_data.size());
+  thrust::device_vector<T> d_result(d_data.size());
+
+  thrust::inclusive_scan(h_data.begin(), h_data.end(), h_result.begin());
+  thrust::inclusive_scan(policy, d_data.begin(), d_data.end(), d_result.begin());
+  ASSERT_EQUAL(h_result, d_result);
+
+  h_result.resize(thrust::copy_if(h_data.begin(), h_data.end(), h_result.begin(), is_even<T>()) - h_result.begin());
+  d_result.resize(
+    thrust::copy_if(policy, d_data.begin(), d_data.end(), d_result.begin(), is_even<T>()) - d_result.begin());
+  ASSERT_EQUAL(h_result, d_result);
+
+  thrust::host_vector<T> h_sorted = h_data;
+  thrust::stable_sort(h_sorted.begin(), h_sorted.end());
+  thrust::stable_sort(policy, d_data.begin(), d_data.end());
+  ASSERT_EQUAL(h_sorted, d_data);
+
+  thrust::host_vector<T> h_keys   = h_data;
+  thrust::device_vector<T> d_keys = h_data;
+  thrust::device_vector<T> d_values(h_data.size());
+  thrust::sequence(d_values.begin(), d_values.end());
+  thrust::host_vector<T> h_values = d_values;
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), thrust::greater<T>());
+  thrust::stable_sort_by_key(policy, d_keys.begin(), d_keys.end(), d_values.begin(), thrust::greater<T>());
+  ASSERT_EQUAL(h_keys, d_keys);
+  ASSERT_EQUAL(h_values, d_values);
+
+  h_result.resize(2 * h_data.size());
+  d_result.resize(2 * h_data.size());
+  thrust::merge(h_sorted.begin(), h_sorted.end(), h_sorted.begin(), h_sorted.end(), h_result.begin());
+  thrust::merge(policy, d_data.begin(), d_data.end(), d_data.begin(), d_data.end(), d_result.begin());
+  ASSERT_EQUAL(h_result, d_result);
+
+  h_result.resize(
+    thrust::set_union(h_sorted.begin(), h_sorted.end(), h_keys.rbegin(), h_keys.rend(), h_result.begin())
+    - h_result.begin());
+  d_result.resize(
+    thrust::set_union(policy, d_data.begin(), d_data.end(), d_keys.rbegin(), d_keys.rend(), d_result.begin())
+    - d_result.begin());
+  ASSERT_EQUAL(h_result, d_result);
+
+  thrust::host_vector<T> h_unique_keys(h_data.size());
+  thrust::host_vector<T> h_sums(h_data.size());
+  thrust::device_vector<T> d_unique_keys(h_data.size());
+  thrust::device_vector<T> d_sums(h_data.size());
+  h_unique_keys.resize(
+    thrust::reduce_by_key(h_sorted.begin(), h_sorted.end(), h_data.begin(), h_unique_keys.begin(), h_sums.begin())
+      .first
+    - h_unique_keys.begin());
+  d_unique_keys.resize(
+    thrust::reduce_by_key(
+      policy, d_data.begin(), d_data.end(), d_original.begin(), d_unique_keys.begin(), d_sums.begin())
+      .first
+    - d_unique_keys.begin());
+  h_sums.resize(h_unique_keys.size());
+  d_sums.resize(d_unique_keys.size());
+  ASSERT_EQUAL(h_unique_keys, d_unique_keys);
+  ASSERT_EQUAL(h_sums, d_sums);
+
+  thrust::host_vector<size_t> h_bounds(h_data.size());
+  thrust::device_vector<size_t> d_bounds(h_data.size());
+  thrust::lower_bound(h_sorted.begin(), h_sorted.end(), h_data.begin(), h_data.end(), h_bounds.begin());
+  thrust::lower_bound(policy, d_data.begin(), d_data.end(), d_original.begin(), d_original.end(), d_bounds.begin());
+  ASSERT_EQUAL(h_bounds, d_bounds);
+}
+
+template <typename T>
+struct TestTbbParConfig
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+    ::tbb::task_arena arena(2);
+
+    check_algorithms(thrust::tbb::par.on(arena), h_data);
+    check_algorithms(thrust::tbb::par.grain(100), h_data);
+    check_algorithms(thrust::tbb::par.grain(n + 1).cutoff(n + 1), h_data);
+    check_algorithms(thrust::tbb::par.on(arena).grain(16).cutoff(64), h_data);
+    check_algorithms(thrust::tbb::par(std::allocator<char>()).on(arena).cutoff(32), h_data);
+  }
+};
+VariableUnitTest<TestTbbParConfig, IntegralTypes> TestTbbParConfigInstance;
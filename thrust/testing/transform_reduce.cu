@@ -73,6 +73,29 @@ void TestTransformReduce(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestTransformReduce);
 
+template <typename T>
+void TestTransformReduceInOrder(const size_t n)
+{
+  thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  T expected = h_data.empty() ? T(0) : h_data[0];
+  for (size_t i = 0; i < n; i++)
+  {
+    expected = thrust::maximum<T>()(expected, thrust::negate<T>()(h_data[i]));
+  }
+
+  T init = h_data.empty() ? T(0) : h_data[0];
+
+  ASSERT_EQUAL(
+    expected,
+    thrust::transform_reduce(h_data.begin(), h_data.end(), thrust::negate<T>(), init, thrust::maximum<T>()));
+  ASSERT_EQUAL(
+    expected,
+    thrust::transform_reduce(d_data.begin(), d_data.end(), thrust::negate<T>(), init, thrust::maximum<T>()));
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestTransformReduceInOrder);
+
 template <typename T>
 void TestTransformReduceFromConst(const size_t n)
 {
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/sort.h>
+
+#include <unittest/assertions.h>
+#include <unittest/random.h>
+
+namespace unittest
+{
+
+// Fills a with n sorted random integers and b with a much smaller number of
+// them, so that merges and set operations gallop over most of a.
+template <typename T>
+void sorted_skewed_inputs(
+  const size_t n, THRUST_NS_QUALIFIER::host_vector<T>& a, THRUST_NS_QUALIFIER::host_vector<T>& b)
+{
+  a = random_integers<T>(n);
+  b = random_integers<T>(n / 64 + 1);
+
+  THRUST_NS_QUALIFIER::sort(a.begin(), a.end());
+  THRUST_NS_QUALIFIER::sort(b.begin(), b.end());
+}
+
+// Compares a merge or set operation against its std:: counterpart on skewed
+// inputs, in both orders. Both operations take the iterators of the two inputs
+// and the output, and return the end of the output.
+template <typename T, typename HostOperation, typename DeviceOperation>
+void check_skewed_inputs(const size_t n, HostOperation host_op, DeviceOperation device_op)
+{
+  THRUST_NS_QUALIFIER::host_vector<T> h_a, h_b;
+  sorted_skewed_inputs(n, h_a, h_b);
+
+  const THRUST_NS_QUALIFIER::device_vector<T> d_a = h_a;
+  const THRUST_NS_QUALIFIER::device_vector<T> d_b = h_b;
+
+  for (int swapped = 0; swapped < 2; ++swapped)
+  {
+    const THRUST_NS_QUALIFIER::host_vector<T>& h_x   = swapped ? h_b : h_a;
+    const THRUST_NS_QUALIFIER::host_vector<T>& h_y   = swapped ? h_a : h_b;
+    const THRUST_NS_QUALIFIER::device_vector<T>& d_x = swapped ? d_b : d_a;
+    const THRUST_NS_QUALIFIER::device_vector<T>& d_y = swapped ? d_a : d_b;
+
+    THRUST_NS_QUALIFIER::host_vector<T> h_result(h_a.size() + h_b.size());
+    THRUST_NS_QUALIFIER::device_vector<T> d_result(h_a.size() + h_b.size());
+
+    h_result.erase(host_op(h_x.begin(), h_x.end(), h_y.begin(), h_y.end(), h_result.begin()), h_result.end());
+    d_result.erase(device_op(d_x.begin(), d_x.end(), d_y.begin(), d_y.end(), d_result.begin()), d_result.end());
+
+    ASSERT_EQUAL(h_result, d_result);
+  }
+}
+
+} // namespace unittest
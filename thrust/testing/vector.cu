@@ -777,6 +777,68 @@ void TestVectorResizing()
 }
 DECLARE_VECTOR_UNITTEST(TestVectorResizing);
 
+template <class Vector>
+void TestVectorNoInit()
+{
+  using T = typename Vector::value_type;
+
+  Vector v(3, thrust::no_init);
+  ASSERT_EQUAL(v.size(), 3lu);
+
+  thrust::sequence(v.begin(), v.end());
+
+  // growing keeps the existing elements, within the capacity and past it
+  v.reserve(5);
+  v.resize(5, thrust::no_init);
+  ASSERT_EQUAL(v.size(), 5lu);
+  v.resize(100, thrust::no_init);
+  ASSERT_EQUAL(v.size(), 100lu);
+  ASSERT_EQUAL(v[0], T(0));
+  ASSERT_EQUAL(v[1], T(1));
+  ASSERT_EQUAL(v[2], T(2));
+
+  v.resize(2, thrust::no_init);
+  ASSERT_EQUAL(v.size(), 2lu);
+  ASSERT_EQUAL(v[1], T(1));
+
+  Vector w(0, thrust::no_init, typename Vector::allocator_type());
+  ASSERT_EQUAL(w.size(), 0lu);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorNoInit);
+
+struct default_constructed_to_42
+{
+  int value;
+
+  _CCCL_HOST_DEVICE default_constructed_to_42()
+      : value(42)
+  {}
+};
+
+template <class Vector>
+void TestVectorNoInitNonTrivial()
+{
+  // default initialization of a type that is not trivially default constructible still runs its constructor
+  Vector v(10, thrust::no_init);
+  v.resize(20, thrust::no_init);
+
+  for (std::size_t i = 0; i < v.size(); ++i)
+  {
+    default_constructed_to_42 x = v[i];
+    ASSERT_EQUAL(x.value, 42);
+  }
+}
+void TestVectorNoInitNonTrivialHost()
+{
+  TestVectorNoInitNonTrivial<thrust::host_vector<default_constructed_to_42>>();
+}
+DECLARE_UNITTEST(TestVectorNoInitNonTrivialHost);
+void TestVectorNoInitNonTrivialDevice()
+{
+  TestVectorNoInitNonTrivial<thrust::device_vector<default_constructed_to_42>>();
+}
+DECLARE_UNITTEST(TestVectorNoInitNonTrivialDevice);
+
 template <class Vector>
 void TestVectorReserving()
 {
@@ -86,6 +86,22 @@ default_construct_range(Allocator& a, Pointer p, Size n)
   thrust::uninitialized_fill_n(allocator_system<Allocator>::get(a), p, n, typename pointer_element<Pointer>::type());
 }
 
+// default initialization of trivially default constructible elements leaves them uninitialized, whatever the
+// allocator
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::__enable_if_t<
+  ::cuda::std::is_trivially_default_constructible<typename pointer_element<Pointer>::type>::value>
+default_init_range(Allocator&, Pointer, Size)
+{}
+
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::__enable_if_t<
+  !::cuda::std::is_trivially_default_constructible<typename pointer_element<Pointer>::type>::value>
+default_init_range(Allocator& a, Pointer p, Size n)
+{
+  allocator_traits_detail::default_construct_range(a, p, n);
+}
+
 } // namespace allocator_traits_detail
 
 template <typename Allocator, typename Pointer, typename Size>
@@ -94,5 +110,11 @@ _CCCL_HOST_DEVICE void default_construct_range(Allocator& a, Pointer p, Size n)
   return allocator_traits_detail::default_construct_range(a, p, n);
 }
 
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE void default_init_range(Allocator& a, Pointer p, Size n)
+{
+  return allocator_traits_detail::default_init_range(a, p, n);
+}
+
 } // namespace detail
 THRUST_NAMESPACE_END
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/host_caching_resource.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/device_memory_resource.h>
 #include <thrust/mr/disjoint_tls_pool.h>
@@ -42,6 +43,11 @@ single_device_tls_caching_allocator()
   return {&thrust::mr::tls_disjoint_pool(thrust::mr::get_global_resource<thrust::device_memory_resource>(),
                                          thrust::mr::get_global_resource<thrust::mr::new_delete_resource>())};
 }
+
+inline _CCCL_HOST thrust::mr::allocator<char, host_caching_resource> single_host_tls_caching_allocator()
+{
+  return {&host_tls_caching_resource()};
+}
 } // namespace detail
 
 THRUST_NAMESPACE_END
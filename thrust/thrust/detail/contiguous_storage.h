@@ -104,6 +104,8 @@ public:
 
   _CCCL_HOST_DEVICE void default_construct_n(iterator first, size_type n);
 
+  _CCCL_HOST_DEVICE void default_init_n(iterator first, size_type n);
+
   _CCCL_HOST_DEVICE void uninitialized_fill_n(iterator first, size_type n, const value_type& value);
 
   template <typename InputIterator>
@@ -0,0 +1,256 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool_options.h>
+
+#include <cuda/std/bit>
+
+#include <cstddef>
+#include <limits>
+
+// The number of bytes in freed blocks that the cache of each thread keeps at most. Blocks freed past this limit go
+// back to the system right away. Defaults to 256 MiB.
+#ifndef THRUST_HOST_CACHING_RESOURCE_MAX_BYTES_CACHED
+#  define THRUST_HOST_CACHING_RESOURCE_MAX_BYTES_CACHED (std::size_t(1) << 28)
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+// A memory resource that keeps the blocks deallocated through it for later allocations of a similar size, meant for
+// the temporary storage of host algorithms. Sizes are rounded up to one of four size classes per power of two, and a
+// block is reused by any request in its size class. Not thread safe; see host_tls_caching_resource.
+//
+// Cached blocks are kept until they are reused, until release() or the destructor returns them upstream, or until
+// lowering the limit on the cached bytes trims them. A block whose deallocation would take the cache past that limit
+// is returned upstream immediately.
+//
+// This is a much simpler cache than the pools in thrust/mr, because it has to be usable from the temporary buffer
+// functions of the host systems, which the containers those pools keep their bookkeeping in are built on.
+class host_caching_resource final : public thrust::mr::memory_resource<>
+{
+  static constexpr std::size_t size_class_bits    = 2;
+  static constexpr std::size_t size_class_count   = (sizeof(std::size_t) * 8) << size_class_bits;
+  static constexpr std::size_t smallest_size_log2 = 4;
+
+  using upstream_resource = thrust::mr::new_delete_resource;
+
+public:
+  explicit host_caching_resource(std::size_t max_bytes_cached = THRUST_HOST_CACHING_RESOURCE_MAX_BYTES_CACHED)
+      : m_upstream(thrust::mr::get_global_resource<upstream_resource>())
+      , m_free_lists()
+      , m_stats()
+      , m_max_bytes_cached(max_bytes_cached)
+  {}
+
+  host_caching_resource(const host_caching_resource&)            = delete;
+  host_caching_resource& operator=(const host_caching_resource&) = delete;
+
+  ~host_caching_resource()
+  {
+    release();
+  }
+
+  // returns all cached blocks to upstream
+  void release()
+  {
+    trim(0);
+  }
+
+  std::size_t max_bytes_cached() const
+  {
+    return m_max_bytes_cached;
+  }
+
+  // changes the limit on the cached bytes, returning the largest cached blocks upstream until the cache fits in it
+  void set_max_bytes_cached(std::size_t max_bytes_cached)
+  {
+    m_max_bytes_cached = max_bytes_cached;
+    trim(max_bytes_cached);
+  }
+
+  thrust::mr::pool_statistics get_stats() const
+  {
+    return m_stats;
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    ++m_stats.allocations;
+
+    // blocks are only cached at the default alignment, and sizes close to the limit cannot be rounded up
+    if (alignment > THRUST_MR_DEFAULT_ALIGNMENT || bytes > (std::numeric_limits<std::size_t>::max() >> 1))
+    {
+      ++m_stats.oversized_allocations;
+      add_in_use(bytes);
+      return upstream_allocate(bytes, alignment);
+    }
+
+    const std::size_t c    = size_class(bytes);
+    const std::size_t size = class_size(c);
+    add_in_use(size);
+
+    if (free_block* block = m_free_lists[c])
+    {
+      ++m_stats.cache_hits;
+      m_free_lists[c] = block->next;
+      m_stats.bytes_cached -= size;
+      return block;
+    }
+
+    return upstream_allocate(size, THRUST_MR_DEFAULT_ALIGNMENT);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    ++m_stats.deallocations;
+
+    if (alignment > THRUST_MR_DEFAULT_ALIGNMENT || bytes > (std::numeric_limits<std::size_t>::max() >> 1))
+    {
+      m_stats.bytes_in_use -= bytes;
+      upstream_deallocate(p, bytes, alignment);
+      return;
+    }
+
+    const std::size_t c    = size_class(bytes);
+    const std::size_t size = class_size(c);
+    m_stats.bytes_in_use -= size;
+
+    if (size > m_max_bytes_cached - m_stats.bytes_cached)
+    {
+      upstream_deallocate(p, size, THRUST_MR_DEFAULT_ALIGNMENT);
+      return;
+    }
+
+    free_block* block = static_cast<free_block*>(p);
+    block->next       = m_free_lists[c];
+    m_free_lists[c]   = block;
+    m_stats.bytes_cached += size;
+  }
+
+private:
+  struct free_block
+  {
+    free_block* next;
+  };
+
+  // the size class of a request: the power of two at or above it, split into four
+  static std::size_t size_class(std::size_t bytes)
+  {
+    if (bytes <= (std::size_t(1) << smallest_size_log2))
+    {
+      return 0;
+    }
+
+    const std::size_t last     = bytes - 1;
+    const std::size_t octave   = sizeof(std::size_t) * 8 - 1 - ::cuda::std::countl_zero(last);
+    const std::size_t shift    = octave - size_class_bits;
+    const std::size_t mantissa = (last >> shift) - (std::size_t(1) << size_class_bits);
+
+    return ((octave - smallest_size_log2) << size_class_bits) + mantissa + 1;
+  }
+
+  // the size of the blocks in a size class, which is the largest request in it
+  static std::size_t class_size(std::size_t c)
+  {
+    if (c == 0)
+    {
+      return std::size_t(1) << smallest_size_log2;
+    }
+
+    const std::size_t octave   = ((c - 1) >> size_class_bits) + smallest_size_log2;
+    const std::size_t mantissa = ((c - 1) & ((std::size_t(1) << size_class_bits) - 1)) + 1;
+
+    return ((std::size_t(1) << size_class_bits) + mantissa) << (octave - size_class_bits);
+  }
+
+  // returns cached blocks upstream, largest first, until at most max_bytes are cached
+  void trim(std::size_t max_bytes)
+  {
+    for (std::size_t c = size_class_count; c-- > 0 && m_stats.bytes_cached > max_bytes;)
+    {
+      while (m_free_lists[c] && m_stats.bytes_cached > max_bytes)
+      {
+        free_block* block = m_free_lists[c];
+        m_free_lists[c]   = block->next;
+        m_stats.bytes_cached -= class_size(c);
+        upstream_deallocate(block, class_size(c), THRUST_MR_DEFAULT_ALIGNMENT);
+      }
+    }
+  }
+
+  void add_in_use(std::size_t bytes)
+  {
+    m_stats.bytes_in_use += bytes;
+    if (m_stats.bytes_in_use > m_stats.peak_bytes_in_use)
+    {
+      m_stats.peak_bytes_in_use = m_stats.bytes_in_use;
+    }
+  }
+
+  void* upstream_allocate(std::size_t bytes, std::size_t alignment)
+  {
+    void* ret = m_upstream->do_allocate(bytes, alignment);
+
+    ++m_stats.upstream_allocations;
+    m_stats.bytes_upstream += bytes;
+    if (m_stats.bytes_upstream > m_stats.peak_bytes_upstream)
+    {
+      m_stats.peak_bytes_upstream = m_stats.bytes_upstream;
+    }
+
+    return ret;
+  }
+
+  void upstream_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+  {
+    ++m_stats.upstream_deallocations;
+    m_stats.bytes_upstream -= bytes;
+
+    m_upstream->do_deallocate(p, bytes, alignment);
+  }
+
+  upstream_resource* m_upstream;
+  free_block* m_free_lists[size_class_count];
+  thrust::mr::pool_statistics m_stats;
+  std::size_t m_max_bytes_cached;
+};
+
+// The instance of host_caching_resource owned by the calling thread. Blocks allocated from it must be deallocated by
+// the same thread. The blocks it caches, up to THRUST_HOST_CACHING_RESOURCE_MAX_BYTES_CACHED, are kept until the thread
+// exits or calls release() on it.
+inline _CCCL_HOST host_caching_resource& host_tls_caching_resource()
+{
+  static thread_local host_caching_resource resource;
+  return resource;
+}
+
+} // namespace detail
+THRUST_NAMESPACE_END
@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstddef>
+#include <cuda/std/tuple>
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+// compares two tuples of references lexicographically, starting with element Index
+template <::cuda::std::size_t Index, ::cuda::std::size_t N>
+struct decomposed_less
+{
+  template <typename Tuple>
+  _CCCL_HOST_DEVICE static bool apply(const Tuple& lhs, const Tuple& rhs)
+  {
+    if (::cuda::std::get<Index>(lhs) < ::cuda::std::get<Index>(rhs))
+    {
+      return true;
+    }
+
+    if (::cuda::std::get<Index>(rhs) < ::cuda::std::get<Index>(lhs))
+    {
+      return false;
+    }
+
+    return decomposed_less<Index + 1, N>::apply(lhs, rhs);
+  }
+};
+
+template <::cuda::std::size_t N>
+struct decomposed_less<N, N>
+{
+  template <typename Tuple>
+  _CCCL_HOST_DEVICE static bool apply(const Tuple&, const Tuple&)
+  {
+    return false;
+  }
+};
+
+template <typename Decomposer, typename T>
+using decomposed_t = decltype(::cuda::std::declval<const Decomposer&>()(::cuda::std::declval<T&>()));
+
+// decomposers take their key by (mutable) reference, as in CUB, but only read it
+template <typename Decomposer, typename T>
+_CCCL_HOST_DEVICE bool decomposed_compare(const Decomposer& decomposer, const T& lhs, const T& rhs)
+{
+  using tuple_type = ::cuda::std::remove_cv_t<::cuda::std::remove_reference_t<decomposed_t<Decomposer, T>>>;
+
+  return decomposed_less<0, ::cuda::std::tuple_size<tuple_type>::value>::apply(
+    decomposer(const_cast<T&>(lhs)), decomposer(const_cast<T&>(rhs)));
+}
+
+} // end namespace detail
+
+/*! \addtogroup comparison_operations Comparison Operations
+ *  \ingroup predefined_function_objects
+ *  \{
+ */
+
+/*! \p decomposer_less is a function object which orders keys by the fields a
+ *  \c Decomposer exposes. As with CUB's radix sort, a decomposer maps a key to a
+ *  \c cuda::std::tuple of references to the arithmetic members it should be
+ *  sorted by, the most significant first. <tt>decomposer_less<Decomposer>{d}(x, y)</tt>
+ *  returns \c true if the tuple <tt>d(x)</tt> is lexicographically less than <tt>d(y)</tt>.
+ *
+ *  Passed to \p sort, \p sort_by_key, \p stable_sort or \p stable_sort_by_key,
+ *  it lets the host systems (\c cpp, \c omp and \c tbb) radix sort the keys
+ *  instead of comparing them. Other systems sort with it as with any other
+ *  comparator.
+ *
+ *  The following code snippet sorts records by tenant and then by timestamp.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <cuda/std/tuple>
+ *  ...
+ *  struct record
+ *  {
+ *    std::uint32_t tenant;
+ *    std::int64_t timestamp;
+ *    float payload;
+ *  };
+ *
+ *  struct record_decomposer
+ *  {
+ *    cuda::std::tuple<std::uint32_t&, std::int64_t&> operator()(record& r) const
+ *    {
+ *      return {r.tenant, r.timestamp};
+ *    }
+ *  };
+ *  ...
+ *  thrust::stable_sort(thrust::host, records.begin(), records.end(),
+ *                      thrust::decomposer_less<record_decomposer>());
+ *  \endcode
+ *
+ *  \tparam Decomposer is a function object which takes a key by reference and
+ *          returns a tuple of references to arithmetic members of at most 8 bytes.
+ *
+ *  \see decomposer_greater
+ *  \see make_decomposer_less
+ */
+template <typename Decomposer>
+struct decomposer_less
+{
+  /*! The decomposer which exposes the fields of a key.
+   */
+  Decomposer decomposer;
+
+  /*! Function call operator. The return value is <tt>decomposer(x) < decomposer(y)</tt>.
+   */
+  template <typename T>
+  _CCCL_HOST_DEVICE bool operator()(const T& x, const T& y) const
+  {
+    return detail::decomposed_compare(decomposer, x, y);
+  }
+}; // end decomposer_less
+
+/*! \p decomposer_greater is the descending counterpart of \p decomposer_less.
+ *  <tt>decomposer_greater<Decomposer>{d}(x, y)</tt> returns \c true if the tuple
+ *  <tt>d(y)</tt> is lexicographically less than <tt>d(x)</tt>.
+ *
+ *  \tparam Decomposer is a function object which takes a key by reference and
+ *          returns a tuple of references to arithmetic members of at most 8 bytes.
+ *
+ *  \see decomposer_less
+ *  \see make_decomposer_greater
+ */
+template <typename Decomposer>
+struct decomposer_greater
+{
+  /*! The decomposer which exposes the fields of a key.
+   */
+  Decomposer decomposer;
+
+  /*! Function call operator. The return value is <tt>decomposer(y) < decomposer(x)</tt>.
+   */
+  template <typename T>
+  _CCCL_HOST_DEVICE bool operator()(const T& x, const T& y) const
+  {
+    return detail::decomposed_compare(decomposer, y, x);
+  }
+}; // end decomposer_greater
+
+/*! \p make_decomposer_less creates a \p decomposer_less from a decomposer.
+ *
+ *  \param decomposer The decomposer which exposes the fields of a key.
+ *  \return A \p decomposer_less ordering keys by <tt>decomposer</tt>.
+ *
+ *  \see decomposer_less
+ */
+template <typename Decomposer>
+_CCCL_HOST_DEVICE decomposer_less<Decomposer> make_decomposer_less(Decomposer decomposer)
+{
+  return decomposer_less<Decomposer>{decomposer};
+}
+
+/*! \p make_decomposer_greater creates a \p decomposer_greater from a decomposer.
+ *
+ *  \param decomposer The decomposer which exposes the fields of a key.
+ *  \return A \p decomposer_greater ordering keys by <tt>decomposer</tt>.
+ *
+ *  \see decomposer_greater
+ */
+template <typename Decomposer>
+_CCCL_HOST_DEVICE decomposer_greater<Decomposer> make_decomposer_greater(Decomposer decomposer)
+{
+  return decomposer_greater<Decomposer>{decomposer};
+}
+
+/*! \}
+ */
+
+THRUST_NAMESPACE_END
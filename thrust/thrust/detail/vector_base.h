@@ -42,6 +42,35 @@
 
 THRUST_NAMESPACE_BEGIN
 
+/*! \addtogroup containers Containers
+ *  \{
+ */
+
+/*! \p no_init_t is the type of \p no_init, which is passed to the constructors and to \p resize of Thrust's vectors
+ *  to have new elements default-initialized instead of value-initialized. Elements of trivially default constructible
+ *  types are then left uninitialized, so that a vector about to be overwritten is not filled with zeroes first.
+ */
+struct no_init_t
+{
+  explicit no_init_t() = default;
+};
+
+/*! \p no_init is passed to the constructors and to \p resize of Thrust's vectors to leave new elements of trivially
+ *  default constructible types uninitialized.
+ *
+ *  \code
+ *  #include <thrust/host_vector.h>
+ *  ...
+ *  thrust::host_vector<float> v(1 << 30, thrust::no_init);
+ *  // the elements of v are uninitialized until written
+ *  thrust::copy(first, last, v.begin());
+ *  \endcode
+ */
+THRUST_INLINE_CONSTANT no_init_t no_init{};
+
+/*! \} // containers
+ */
+
 namespace detail
 {
 
@@ -90,6 +119,21 @@ public:
    */
   explicit vector_base(size_type n, const Alloc& alloc);
 
+  /*! This constructor creates a vector_base with default-initialized
+   *  elements, which are left uninitialized if they are trivially
+   *  default constructible.
+   *  \param n The number of elements to create.
+   */
+  explicit vector_base(size_type n, no_init_t);
+
+  /*! This constructor creates a vector_base with default-initialized
+   *  elements, which are left uninitialized if they are trivially
+   *  default constructible.
+   *  \param n The number of elements to create.
+   *  \param alloc The allocator to use by this vector_base.
+   */
+  explicit vector_base(size_type n, no_init_t, const Alloc& alloc);
+
   /*! This constructor creates a vector_base with copies
    *  of an exemplar element.
    *  \param n The number of elements to initially create.
@@ -226,6 +270,18 @@ public:
    */
   void resize(size_type new_size, const value_type& x);
 
+  /*! \brief Resizes this vector_base to the specified number of elements.
+   *  \param new_size Number of elements this vector_base should contain.
+   *  \throw std::length_error If n exceeds max_size().
+   *
+   *  This method will resize this vector_base to the specified number of
+   *  elements. If the number is smaller than this vector_base's current
+   *  size this vector_base is truncated, otherwise this vector_base is
+   *  extended and new elements are default-initialized, which leaves them
+   *  uninitialized if they are trivially default constructible.
+   */
+  void resize(size_type new_size, no_init_t);
+
   /*! Returns the number of elements in this vector_base.
    */
   _CCCL_HOST_DEVICE size_type size() const;
@@ -501,6 +557,8 @@ private:
 
   void default_init(size_type n);
 
+  void default_init(size_type n, no_init_t);
+
   void fill_init(size_type n, const T& x);
 
   // these methods resolve the ambiguity of the insert() template of form (iterator, InputIterator, InputIterator)
@@ -512,8 +570,8 @@ private:
   template <typename InputIteratorOrIntegralType>
   void insert_dispatch(iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
 
-  // this method appends n default-constructed elements at the end
-  void append(size_type n);
+  // this method appends n elements at the end, value-initialized, or default-initialized if value_init is false
+  void append(size_type n, bool value_init = true);
 
   // this method performs insertion from a fill value
   void fill_insert(iterator position, size_type n, const T& x);
@@ -52,6 +52,14 @@ THRUST_NAMESPACE_BEGIN
  *  automatic. The memory associated with a \p host_vector resides in memory
  *  accessible to hosts.
  *
+ *  With the default allocator, elements are constructed and copied by the
+ *  calling thread. Using an allocator of a parallel host system instead, as in
+ *  <tt>host_vector<T, thrust::omp::allocator<T>></tt> or
+ *  <tt>host_vector<T, thrust::tbb::allocator<T>></tt>, makes the vector
+ *  construct, copy and reallocate its elements with that system. Elements
+ *  which are trivially relocatable are then copied with one \p memcpy per
+ *  chunk, in parallel.
+ *
  *  \see https://en.cppreference.com/w/cpp/container/vector
  *  \see device_vector
  *  \see universal_vector
@@ -106,6 +114,25 @@ public:
       : Parent(n, alloc)
   {}
 
+  /*! This constructor creates a \p host_vector with the given
+   *  size, whose elements are default-initialized, which leaves them
+   *  uninitialized if they are trivially default constructible.
+   *  \param n The number of elements to initially create.
+   */
+  _CCCL_HOST explicit host_vector(size_type n, no_init_t)
+      : Parent(n, no_init)
+  {}
+
+  /*! This constructor creates a \p host_vector with the given
+   *  size, whose elements are default-initialized, which leaves them
+   *  uninitialized if they are trivially default constructible.
+   *  \param n The number of elements to initially create.
+   *  \param alloc The allocator to use by this host_vector.
+   */
+  _CCCL_HOST explicit host_vector(size_type n, no_init_t, const Alloc& alloc)
+      : Parent(n, no_init, alloc)
+  {}
+
   /*! This constructor creates a \p host_vector with copies
    *  of an exemplar element.
    *  \param n The number of elements to initially create.
@@ -288,6 +315,18 @@ public:
      */
     void resize(size_type new_size, const value_type &x = value_type());
 
+    /*! \brief Resizes this vector to the specified number of elements.
+     *  \param new_size Number of elements this vector should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector to the specified number of
+     *  elements. If the number is smaller than this vector's current
+     *  size this vector is truncated, otherwise this vector is extended
+     *  and new elements are default-initialized, which leaves them
+     *  uninitialized if they are trivially default constructible.
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector.
      */
     size_type size() const;
@@ -105,6 +105,10 @@ public:
     ret.cached_size_cutoff_factor      = 16;
     ret.cached_alignment_cutoff_factor = 16;
 
+    ret.max_bytes_per_thread_cache = static_cast<std::size_t>(1) << 22;
+    ret.thread_cache_trim_interval = 1024;
+    ret.max_remote_free_batches    = 16;
+
     return ret;
   }
 
@@ -124,6 +128,7 @@ public:
       , m_allocated(m_bookkeeper)
       , m_cached_oversized(m_bookkeeper)
       , m_oversized(m_bookkeeper)
+      , m_stats()
   {
     assert(m_options.validate());
 
@@ -147,6 +152,7 @@ public:
       , m_allocated(m_bookkeeper)
       , m_cached_oversized(m_bookkeeper)
       , m_oversized(m_bookkeeper)
+      , m_stats()
   {
     assert(m_options.validate());
 
@@ -265,7 +271,22 @@ private:
   // list of all oversized/overaligned allocations from upstream
   oversized_block_vector m_oversized;
 
+  pool_statistics m_stats;
+
+  void update_peaks()
+  {
+    m_stats.peak_bytes_in_use   = (std::max)(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+    m_stats.peak_bytes_upstream = (std::max)(m_stats.peak_bytes_upstream, m_stats.bytes_upstream);
+  }
+
 public:
+  /*! Returns a snapshot of the activity of this resource, for tuning its options.
+   */
+  pool_statistics get_stats() const
+  {
+    return m_stats;
+  }
+
   /*! Releases all held memory to upstream.
    */
   void release()
@@ -289,6 +310,11 @@ public:
       m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
     }
 
+    m_stats.upstream_deallocations += m_allocated.size() + m_oversized.size();
+    m_stats.bytes_in_use   = 0;
+    m_stats.bytes_cached   = 0;
+    m_stats.bytes_upstream = 0;
+
     m_allocated.clear();
     m_oversized.clear();
     m_cached_oversized.clear();
@@ -300,9 +326,13 @@ public:
     bytes = (std::max)(bytes, m_options.smallest_block_size);
     assert(detail::is_power_of_2(alignment));
 
+    ++m_stats.allocations;
+
     // an oversized and/or overaligned allocation requested; needs to be allocated separately
     if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
     {
+      ++m_stats.oversized_allocations;
+
       oversized_block_descriptor oversized;
       oversized.size      = bytes;
       oversized.alignment = alignment;
@@ -344,6 +374,13 @@ public:
         if (it != m_cached_oversized.end())
         {
           oversized.pointer = (*it).pointer;
+
+          ++m_stats.cache_hits;
+          ++m_stats.oversized_cache_hits;
+          m_stats.bytes_cached -= (*it).size;
+          m_stats.bytes_in_use += (*it).size;
+          update_peaks();
+
           m_cached_oversized.erase(it);
           return oversized.pointer;
         }
@@ -353,6 +390,11 @@ public:
       oversized.pointer = m_upstream->do_allocate(bytes, alignment);
       m_oversized.push_back(oversized);
 
+      ++m_stats.upstream_allocations;
+      m_stats.bytes_upstream += bytes;
+      m_stats.bytes_in_use += bytes;
+      update_peaks();
+
       return oversized.pointer;
     }
 
@@ -362,11 +404,12 @@ public:
     std::size_t bucket_idx = bytes_log2 - m_smallest_block_log2;
     pool& bucket           = m_pools[bucket_idx];
 
+    std::size_t bucket_size = static_cast<std::size_t>(1) << bytes_log2;
+
     // if the free list of the bucket has no elements, allocate a new chunk
     // and split it into blocks pushed to the free list
     if (bucket.free_blocks.empty())
     {
-      std::size_t bucket_size = static_cast<std::size_t>(1) << bytes_log2;
 
       std::size_t n = bucket.previous_allocated_count;
       if (n == 0)
@@ -407,8 +450,20 @@ public:
       {
         bucket.free_blocks.push_back(static_cast<void_ptr>(static_cast<char_ptr>(allocated.pointer) + i * bucket_size));
       }
+
+      ++m_stats.upstream_allocations;
+      m_stats.bytes_upstream += bytes;
+      m_stats.bytes_cached += bytes;
+    }
+    else
+    {
+      ++m_stats.cache_hits;
     }
 
+    m_stats.bytes_cached -= bucket_size;
+    m_stats.bytes_in_use += bucket_size;
+    update_peaks();
+
     // allocate a block from the front of the bucket's free list
     void_ptr ret = bucket.free_blocks.back();
     bucket.free_blocks.pop_back();
@@ -423,6 +478,8 @@ public:
     // verify that the pointer is at least as aligned as claimed
     assert(reinterpret_cast<detail::intmax_t>(detail::pointer_traits<void_ptr>::get(p)) % alignment == 0);
 
+    ++m_stats.deallocations;
+
     // the deallocated block is oversized and/or overaligned
     if (n > m_options.largest_block_size || alignment > m_options.alignment)
     {
@@ -431,11 +488,14 @@ public:
 
       oversized_block_descriptor oversized = *it;
 
+      m_stats.bytes_in_use -= oversized.size;
+
       if (m_options.cache_oversized)
       {
         typename oversized_block_vector::iterator position =
           lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
         m_cached_oversized.insert(position, oversized);
+        m_stats.bytes_cached += oversized.size;
         return;
       }
 
@@ -443,6 +503,9 @@ public:
 
       m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
 
+      ++m_stats.upstream_deallocations;
+      m_stats.bytes_upstream -= oversized.size;
+
       return;
     }
 
@@ -452,6 +515,9 @@ public:
     pool& bucket           = m_pools[bucket_idx];
 
     bucket.free_blocks.push_back(p);
+
+    m_stats.bytes_in_use -= static_cast<std::size_t>(1) << n_log2;
+    m_stats.bytes_cached += static_cast<std::size_t>(1) << n_log2;
   }
 };
 
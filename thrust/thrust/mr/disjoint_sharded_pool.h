@@ -0,0 +1,90 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A synchronized version of \p disjoint_unsynchronized_pool_resource that scales with the number of threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/sharded_pool.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A synchronized version of \p disjoint_unsynchronized_pool_resource that scales with the number of threads using
+ *      it. See \p sharded_pool_resource for how blocks are cached. Uses \p std::mutex, and therefore requires C++11.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks to be handed off to the
+ * user \tparam Bookkeeper the type of memory resources that will be used for allocating bookkeeping memory
+ */
+template <typename Upstream, typename Bookkeeper>
+class disjoint_sharded_pool_resource final
+    : public detail::sharded_pool_base<disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper>>
+{
+  using base = detail::sharded_pool_base<disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper>>;
+
+public:
+  /*! Get the default options for a disjoint pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper>::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param bookkeeper the upstream memory resource for bookkeeping
+   *  \param options pool options to use
+   */
+  disjoint_sharded_pool_resource(
+    Upstream* upstream, Bookkeeper* bookkeeper, pool_options options = get_default_options())
+      : base(options, upstream, bookkeeper)
+  {}
+
+  /*! Constructor. Upstream and bookkeeping resources are obtained by calling \p get_global_resource for their types.
+   *
+   *  \param options pool options to use
+   */
+  disjoint_sharded_pool_resource(pool_options options = get_default_options())
+      : base(options, get_global_resource<Upstream>(), get_global_resource<Bookkeeper>())
+  {}
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
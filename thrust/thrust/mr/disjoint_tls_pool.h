@@ -15,7 +15,8 @@
  */
 
 /*! \file disjoint_tls_pool.h
- *  \brief A function wrapping a thread local instance of a \p disjoint_unsynchronized_pool_resource.
+ *  \brief A function wrapping a thread local instance of a \p disjoint_unsynchronized_pool_resource, and a synchronized
+ *      pool resource that caches blocks per thread in front of a shared \p disjoint_unsynchronized_pool_resource.
  */
 
 #pragma once
@@ -30,6 +31,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/tls_pool.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -44,6 +46,9 @@ namespace mr
 /*! Potentially constructs, if not yet created, and then returns the address of a thread-local
  *      \p disjoint_unsynchronized_pool_resource,
  *
+ *  Blocks cached by the returned pool are only ever reused by the thread that created it; see
+ *  \p disjoint_tls_pool_resource for a pool whose per-thread caches are bounded and shared between threads.
+ *
  *  \tparam Upstream the first template argument to the pool template
  *  \tparam Bookkeeper the second template argument to the pool template
  *  \param upstream the first argument to the constructor, if invoked
@@ -64,5 +69,54 @@ tls_disjoint_pool(Upstream* upstream = nullptr, Bookkeeper* bookkeeper = nullptr
 /*! \}
  */
 
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A synchronized version of \p disjoint_unsynchronized_pool_resource that caches blocks per thread. See
+ *      \p tls_pool_resource for how blocks are cached. Uses \p std::mutex, and therefore requires C++11.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks to be handed off to the
+ * user \tparam Bookkeeper the type of memory resources that will be used for allocating bookkeeping memory
+ */
+template <typename Upstream, typename Bookkeeper>
+class disjoint_tls_pool_resource final
+    : public detail::thread_caching_pool_base<disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper>>
+{
+  using base = detail::thread_caching_pool_base<disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper>>;
+
+public:
+  /*! Get the default options for a disjoint pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper>::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param bookkeeper the upstream memory resource for bookkeeping
+   *  \param options pool options to use
+   */
+  disjoint_tls_pool_resource(Upstream* upstream, Bookkeeper* bookkeeper, pool_options options = get_default_options())
+      : base(options, upstream, bookkeeper)
+  {}
+
+  /*! Constructor. Upstream and bookkeeping resources are obtained by calling \p get_global_resource for their types.
+   *
+   *  \param options pool options to use
+   */
+  disjoint_tls_pool_resource(pool_options options = get_default_options())
+      : base(options, get_global_resource<Upstream>(), get_global_resource<Bookkeeper>())
+  {}
+};
+
+/*! \} // memory_resources
+ */
+
 } // namespace mr
 THRUST_NAMESPACE_END
@@ -0,0 +1,394 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief \p mmap based memory resources, optionally backed by huge pages or placed on particular NUMA nodes. Only
+ *      available on Linux.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if defined(__linux__)
+
+#  include <thrust/detail/integer_math.h>
+#  include <thrust/mr/memory_resource.h>
+#  include <thrust/system/detail/bad_alloc.h>
+
+#  include <algorithm>
+#  include <cerrno>
+#  include <cstddef>
+#  include <cstdint>
+#  include <cstring>
+#  include <string>
+
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! Whether, and how, \p mmap based memory resources back their allocations with huge pages.
+ */
+enum class huge_page_mode
+{
+  /*! Use the system's base pages. */
+  none,
+  /*! Advise the kernel to back allocations with transparent huge pages, with <tt>madvise(MADV_HUGEPAGE)</tt>. The
+   *      kernel may still use base pages, for instance for the parts of an allocation that do not span a whole,
+   *      aligned huge page. */
+  transparent,
+  /*! Map allocations from the system's pool of reserved huge pages, with \p MAP_HUGETLB. Allocations fail with
+   *      \p std::bad_alloc if not enough huge pages are reserved. */
+  hugetlb
+};
+
+/*! Which NUMA nodes \p mmap based memory resources place the pages of their allocations on.
+ */
+enum class numa_policy
+{
+  /*! Follow the calling thread's memory policy; by default, each page is placed on the node of the thread that first
+   *      touches it. */
+  none,
+  /*! Interleave pages across the nodes in \p mmap_options::numa_nodes. */
+  interleave,
+  /*! Place pages only on the nodes in \p mmap_options::numa_nodes. */
+  bind,
+  /*! Place pages on the first node in \p mmap_options::numa_nodes, falling back to other nodes when it is full. */
+  preferred
+};
+
+/*! A type used for configuring \p mmap based memory resources.
+ */
+struct mmap_options
+{
+  /*! Whether, and how, allocations are backed by huge pages.
+   */
+  huge_page_mode huge_pages;
+  /*! The size of huge pages. With \p huge_page_mode::hugetlb, it must be a size the system supports, such as 2 MiB or
+   *      1 GiB on x86-64, and the size of every allocation is rounded up to a multiple of it.
+   */
+  std::size_t huge_page_size;
+  /*! Decides whether the pages of an allocation are faulted in when it is made, with \p MAP_POPULATE, rather than on
+   *      first touch.
+   */
+  bool populate;
+  /*! The minimal alignment of all allocations. Allocations are always aligned to at least the page size; larger
+   *      alignments are obtained by mapping more memory than requested, and unmapping the excess.
+   */
+  std::size_t alignment;
+
+  /*! The NUMA placement of allocations, applied with \p mbind before any of their pages are touched. The system call is
+   *      made directly, so libnuma is not required; on a kernel without NUMA support, or if \p mbind fails, the
+   *      allocation is still made, with the default placement.
+   */
+  numa_policy numa;
+  /*! The NUMA nodes \p numa refers to, as a bit mask of node ids: bit \p i set selects node \p i. Zero selects all the
+   *      nodes the calling process may allocate on.
+   */
+  std::uint64_t numa_nodes;
+};
+
+/*! The common implementation of \p mmap_memory_resource and \p huge_page_memory_resource.
+ */
+class mmap_memory_resource_base : public memory_resource<>
+{
+public:
+  /*! Constructor.
+   *
+   *  \param options the options to use
+   */
+  mmap_memory_resource_base(mmap_options options)
+      : m_options(options)
+      , m_page_size(static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)))
+  {}
+
+  /*! Returns the options the resource was constructed with.
+   */
+  const mmap_options& options() const
+  {
+    return m_options;
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    const std::size_t granule = granularity();
+    const std::size_t length  = round_up(bytes, granule);
+
+    alignment = (std::max)((std::max)(alignment, m_options.alignment), granule);
+
+    // anything aligned beyond the granularity is found in a bigger mapping, whose excess is unmapped below
+    const std::size_t mapped_length = length + alignment - granule;
+
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (m_options.huge_pages == huge_page_mode::hugetlb)
+    {
+      flags |= MAP_HUGETLB;
+#  if defined(MAP_HUGE_SHIFT)
+      flags |= static_cast<int>(thrust::detail::log2(m_options.huge_page_size)) << MAP_HUGE_SHIFT;
+#  endif
+    }
+
+    // transparent huge pages and NUMA placement must be asked for before the pages are faulted in, so that mappings
+    // are only populated up front if there is no need to madvise, mbind or unmap anything first
+    const bool populate_on_map = m_options.populate && mapped_length == length
+                              && m_options.huge_pages != huge_page_mode::transparent
+                              && m_options.numa == numa_policy::none;
+#  if defined(MAP_POPULATE)
+    if (populate_on_map)
+    {
+      flags |= MAP_POPULATE;
+    }
+#  endif
+
+    void* mapping = ::mmap(nullptr, mapped_length, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+      throw thrust::system::detail::bad_alloc(std::string("mmap_memory_resource::do_allocate: mmap failed: ")
+                                              + std::strerror(errno));
+    }
+
+    char* const base = static_cast<char*>(mapping);
+    char* const ret  = base + (alignment - reinterpret_cast<std::uintptr_t>(base) % alignment) % alignment;
+
+    if (ret != base)
+    {
+      ::munmap(base, static_cast<std::size_t>(ret - base));
+    }
+    if (ret + length != base + mapped_length)
+    {
+      ::munmap(ret + length, static_cast<std::size_t>(base + mapped_length - (ret + length)));
+    }
+
+#  if defined(MADV_HUGEPAGE)
+    if (m_options.huge_pages == huge_page_mode::transparent)
+    {
+      // advisory only; the memory is still usable if transparent huge pages are disabled
+      ::madvise(ret, length, MADV_HUGEPAGE);
+    }
+#  endif
+
+    if (m_options.numa != numa_policy::none)
+    {
+      place(ret, length);
+    }
+
+    if (m_options.populate && !populate_on_map)
+    {
+      populate(ret, length);
+    }
+
+    return ret;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    (void) alignment;
+    ::munmap(p, round_up(bytes, granularity()));
+  }
+
+private:
+  // the unit in which memory is mapped and unmapped
+  std::size_t granularity() const
+  {
+    return m_options.huge_pages == huge_page_mode::hugetlb ? m_options.huge_page_size : m_page_size;
+  }
+
+  static std::size_t round_up(std::size_t bytes, std::size_t granule)
+  {
+    return (std::max)((bytes + granule - 1) / granule * granule, granule);
+  }
+
+  void place(char* p, std::size_t length) const
+  {
+    // the kernel's MPOL_* and MPOL_F_* values, spelled out so that <numaif.h> is not required
+    int mode = 0;
+    switch (m_options.numa)
+    {
+      case numa_policy::preferred:
+        mode = 1;
+        break;
+      case numa_policy::bind:
+        mode = 2;
+        break;
+      case numa_policy::interleave:
+        mode = 3;
+        break;
+      default:
+        return;
+    }
+    const unsigned long mems_allowed = 1ul << 2;
+
+    unsigned long nodes = static_cast<unsigned long>(m_options.numa_nodes);
+    if (nodes == 0)
+    {
+      int current_mode = 0;
+      if (::syscall(SYS_get_mempolicy, &current_mode, &nodes, 8 * sizeof(nodes) + 1, nullptr, mems_allowed) != 0)
+      {
+        return;
+      }
+    }
+
+    // advisory only; the memory is still usable with the default placement
+    ::syscall(SYS_mbind, p, length, mode, &nodes, 8 * sizeof(nodes) + 1, 0u);
+  }
+
+  void populate(char* p, std::size_t length) const
+  {
+#  if defined(MADV_POPULATE_WRITE)
+    if (::madvise(p, length, MADV_POPULATE_WRITE) == 0)
+    {
+      return;
+    }
+#  endif
+
+    // fall back to touching every page, for kernels that predate MADV_POPULATE_WRITE
+    volatile char* const pages = p;
+    for (std::size_t offset = 0; offset < length; offset += m_page_size)
+    {
+      pages[offset] = 0;
+    }
+  }
+
+  mmap_options m_options;
+  std::size_t m_page_size;
+};
+
+/*! A memory resource that maps every allocation with \p mmap. As each allocation takes at least a page, it is meant for
+ *      large allocations, or as the upstream of a pool resource. By default, allocations use base pages, are faulted
+ *      in on first touch, and are page-aligned; \p mmap_options controls all three.
+ */
+class mmap_memory_resource final : public mmap_memory_resource_base
+{
+public:
+  /*! Get the default options for the resource: base pages, not populated, page alignment.
+   */
+  static mmap_options get_default_options()
+  {
+    mmap_options ret;
+
+    ret.huge_pages     = huge_page_mode::none;
+    ret.huge_page_size = static_cast<std::size_t>(1) << 21;
+    ret.populate       = false;
+    ret.alignment      = 0;
+
+    ret.numa       = numa_policy::none;
+    ret.numa_nodes = 0;
+
+    return ret;
+  }
+
+  /*! Constructor.
+   *
+   *  \param options the options to use
+   */
+  mmap_memory_resource(mmap_options options = get_default_options())
+      : mmap_memory_resource_base(options)
+  {}
+};
+
+/*! A memory resource that maps every allocation with \p mmap, asking for transparent huge pages, and aligning
+ *      allocations to the huge page size so that whole huge pages can back them. Suited to very large containers, such
+ *      as <tt>thrust::host_vector<T, thrust::mr::stateless_resource_allocator<T, huge_page_memory_resource>></tt>,
+ *      whose algorithms would otherwise spend much of their time on TLB misses.
+ */
+class huge_page_memory_resource final : public mmap_memory_resource_base
+{
+public:
+  /*! Get the default options for the resource: transparent huge pages of 2 MiB, not populated, aligned to the huge
+   *      page size.
+   */
+  static mmap_options get_default_options()
+  {
+    mmap_options ret;
+
+    ret.huge_pages     = huge_page_mode::transparent;
+    ret.huge_page_size = static_cast<std::size_t>(1) << 21;
+    ret.populate       = false;
+    ret.alignment      = ret.huge_page_size;
+
+    ret.numa       = numa_policy::none;
+    ret.numa_nodes = 0;
+
+    return ret;
+  }
+
+  /*! Constructor.
+   *
+   *  \param options the options to use
+   */
+  huge_page_memory_resource(mmap_options options = get_default_options())
+      : mmap_memory_resource_base(options)
+  {}
+};
+
+/*! A memory resource that maps every allocation with \p mmap, and by default interleaves its pages across all the NUMA
+ *      nodes the process may allocate on, so that memory shared by threads on all nodes is not all placed on one of
+ *      them. Set \p mmap_options::numa to \p numa_policy::bind instead, with a single node in
+ *      \p mmap_options::numa_nodes, to place the memory used by threads on one node next to them.
+ *
+ *  With \p numa_policy::none, pages are placed next to the thread that touches them first. Containers whose allocator
+ *      belongs to the \p omp system, such as <tt>thrust::host_vector<T, thrust::omp::allocator<T>></tt>, construct
+ *      their elements, and so touch their pages, in parallel, with the same static schedule as the \p omp algorithms.
+ *      \p thrust::omp::numa_allocator combines this resource with the \p omp system.
+ */
+class numa_memory_resource final : public mmap_memory_resource_base
+{
+public:
+  /*! Get the default options for the resource: base pages, not populated, page alignment, interleaved across all nodes.
+   */
+  static mmap_options get_default_options()
+  {
+    mmap_options ret = mmap_memory_resource::get_default_options();
+
+    ret.numa       = numa_policy::interleave;
+    ret.numa_nodes = 0;
+
+    return ret;
+  }
+
+  /*! Constructor.
+   *
+   *  \param options the options to use
+   */
+  numa_memory_resource(mmap_options options = get_default_options())
+      : mmap_memory_resource_base(options)
+  {}
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
+
+#endif // __linux__
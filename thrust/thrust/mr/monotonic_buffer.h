@@ -0,0 +1,234 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A memory resource that hands out memory by bumping a pointer through a buffer, and only frees it all at once.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource that allocates by advancing a pointer through its current buffer, and does nothing on
+ *      deallocation. When the current buffer runs out, a new one, geometrically bigger than the last, is allocated from
+ *      upstream; the first buffer may instead be supplied by the caller. All memory is freed at once by \p release, or
+ *      on destruction.
+ *
+ *  This makes it suitable for scratch memory of a known lifetime, such as the temporary allocations of a sequence of
+ *      algorithms invoked with an allocator wrapping it, as in <tt>thrust::host(alloc)</tt> or
+ *      <tt>thrust::omp::par(alloc)</tt>, which then make no upstream calls at all if the caller supplied buffer fits
+ *      them. Not thread safe.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating buffers
+ */
+template <typename Upstream>
+class monotonic_buffer_resource final : public memory_resource<typename Upstream::pointer>
+{
+  using void_ptr        = typename Upstream::pointer;
+  using void_ptr_traits = thrust::detail::pointer_traits<void_ptr>;
+  using char_ptr        = typename void_ptr_traits::template rebind<char>::other;
+
+  struct buffer
+  {
+    void_ptr pointer;
+    std::size_t size;
+    std::size_t alignment;
+  };
+
+public:
+  /*! The size of the first buffer allocated from upstream, when no size is given.
+   */
+  static constexpr std::size_t default_initial_size = 4096;
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for buffers
+   *  \param initial_size the size of the first buffer allocated from upstream
+   */
+  monotonic_buffer_resource(Upstream* upstream, std::size_t initial_size = default_initial_size)
+      : m_upstream(upstream)
+      , m_initial_buffer()
+      , m_initial_buffer_size(0)
+      , m_initial_size(initial_size > 0 ? initial_size : 1)
+  {
+    release();
+  }
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param initial_size the size of the first buffer allocated from upstream
+   */
+  monotonic_buffer_resource(std::size_t initial_size = default_initial_size)
+      : monotonic_buffer_resource(get_global_resource<Upstream>(), initial_size)
+  {}
+
+  /*! Constructor. Memory is allocated from \p buffer until it runs out, and from upstream after that. The buffer is
+   *      not owned by the resource, and must outlive the memory allocated from it.
+   *
+   *  \param buffer the memory to allocate from first
+   *  \param buffer_size the size of \p buffer, in bytes
+   *  \param upstream the upstream memory resource for buffers
+   */
+  monotonic_buffer_resource(void_ptr buffer, std::size_t buffer_size, Upstream* upstream)
+      : m_upstream(upstream)
+      , m_initial_buffer(buffer)
+      , m_initial_buffer_size(buffer_size)
+      , m_initial_size(buffer_size > 0 ? buffer_size : default_initial_size)
+  {
+    release();
+  }
+
+  /*! Constructor. Memory is allocated from \p buffer until it runs out, and from the upstream resource obtained by
+   *      calling \p get_global_resource<Upstream> after that.
+   *
+   *  \param buffer the memory to allocate from first
+   *  \param buffer_size the size of \p buffer, in bytes
+   */
+  monotonic_buffer_resource(void_ptr buffer, std::size_t buffer_size)
+      : monotonic_buffer_resource(buffer, buffer_size, get_global_resource<Upstream>())
+  {}
+
+  monotonic_buffer_resource(const monotonic_buffer_resource&)            = delete;
+  monotonic_buffer_resource& operator=(const monotonic_buffer_resource&) = delete;
+
+  /*! Destructor. Releases all buffers allocated from upstream.
+   */
+  ~monotonic_buffer_resource()
+  {
+    release();
+  }
+
+  /*! Releases all buffers allocated from upstream, invalidating all memory allocated from the resource, and starts
+   *      allocating from the caller supplied buffer again, if there is one.
+   */
+  void release()
+  {
+    for (const buffer& b : m_buffers)
+    {
+      m_upstream->do_deallocate(b.pointer, b.size, b.alignment);
+    }
+    m_buffers.clear();
+
+    m_current   = static_cast<char_ptr>(m_initial_buffer);
+    m_remaining = m_initial_buffer_size;
+    m_next_size = m_initial_size;
+  }
+
+  /*! Returns the upstream memory resource for buffers.
+   */
+  Upstream* upstream_resource() const
+  {
+    return m_upstream;
+  }
+
+  _CCCL_NODISCARD virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    std::size_t padding = padding_for(alignment);
+
+    if (bytes > m_remaining || padding > m_remaining - bytes)
+    {
+      allocate_buffer(bytes, alignment);
+      padding = padding_for(alignment);
+    }
+
+    char_ptr ret = m_current + padding;
+    m_current    = ret + bytes;
+    m_remaining -= padding + bytes;
+
+    return static_cast<void_ptr>(ret);
+  }
+
+  virtual void do_deallocate(void_ptr, std::size_t, std::size_t = THRUST_MR_DEFAULT_ALIGNMENT) override {}
+
+private:
+  std::size_t padding_for(std::size_t alignment) const
+  {
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(thrust::raw_pointer_cast(m_current));
+    return static_cast<std::size_t>((alignment - address % alignment) % alignment);
+  }
+
+  void allocate_buffer(std::size_t bytes, std::size_t alignment)
+  {
+    std::size_t size = m_next_size;
+    while (size < bytes)
+    {
+      // a buffer this large could never be allocated, and doubling the size again would overflow
+      if (size > (std::numeric_limits<std::size_t>::max)() / 2)
+      {
+        throw thrust::system::detail::bad_alloc("monotonic_buffer_resource::do_allocate: requested size is too large");
+      }
+
+      size *= 2;
+    }
+
+    buffer b;
+    b.size      = size;
+    b.alignment = alignment > THRUST_MR_DEFAULT_ALIGNMENT ? alignment : THRUST_MR_DEFAULT_ALIGNMENT;
+    b.pointer   = m_upstream->do_allocate(b.size, b.alignment);
+    m_buffers.push_back(b);
+
+    m_current   = static_cast<char_ptr>(b.pointer);
+    m_remaining = b.size;
+    m_next_size = size <= (std::numeric_limits<std::size_t>::max)() / 2 ? size * 2 : size;
+  }
+
+  Upstream* m_upstream;
+
+  void_ptr m_initial_buffer;
+  std::size_t m_initial_buffer_size;
+  std::size_t m_initial_size;
+
+  std::vector<buffer> m_buffers;
+  char_ptr m_current;
+  std::size_t m_remaining;
+  std::size_t m_next_size;
+};
+
+template <typename Upstream>
+constexpr std::size_t monotonic_buffer_resource<Upstream>::default_initial_size;
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
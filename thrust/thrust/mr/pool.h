@@ -38,7 +38,11 @@
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
 
+#include <cuda/std/bit>
+
 #include <cassert>
+#include <cstdint>
+#include <vector>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -100,6 +104,10 @@ public:
     ret.cached_size_cutoff_factor      = 16;
     ret.cached_alignment_cutoff_factor = 16;
 
+    ret.max_bytes_per_thread_cache = static_cast<std::size_t>(1) << 22;
+    ret.thread_cache_trim_interval = 1024;
+    ret.max_remote_free_batches    = 16;
+
     return ret;
   }
 
@@ -116,6 +124,7 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_stats()
   {
     assert(m_options.validate());
 
@@ -137,6 +146,7 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_stats()
   {
     assert(m_options.validate());
 
@@ -176,18 +186,9 @@ private:
     chunk_descriptor_ptr next;
   };
 
-  // this was originally a forward list, but I made it a doubly linked list
-  // because that way deallocation when not caching is faster and doesn't require
-  // traversal of a linked list (it's still a forward list for the cached list,
-  // because allocation from that list already traverses)
-  //
-  // TODO: investigate whether it's better to have this be a doubly-linked list
-  // with fast do_deallocate when !m_options.cache_oversized, or to have this be
-  // a forward list and require traversal in do_deallocate
-  //
-  // I assume that it is better this way, but the additional pointer could
-  // potentially hurt? these are supposed to be oversized and/or overaligned,
-  // so they are kinda memory intensive already
+  // all oversized blocks, in use or cached, are kept in a doubly linked list,
+  // so that deallocation when not caching can unlink a block without
+  // traversing the list, and release can find all of them
   struct oversized_block_descriptor
   {
     std::size_t size;
@@ -198,6 +199,32 @@ private:
     std::size_t current_size;
   };
 
+  // cached oversized blocks of a given alignment are kept in segregated free
+  // lists, one per size class; every power of two is split into 16 size
+  // classes, and bitmaps record which lists are not empty, so that the
+  // smallest size class with blocks big enough for a request is found with
+  // two bit scans instead of a walk over all cached blocks
+  static constexpr std::size_t size_class_bits         = 4;
+  static constexpr std::size_t size_classes_per_octave = static_cast<std::size_t>(1) << size_class_bits;
+  static constexpr std::size_t octave_count            = sizeof(std::size_t) * 8;
+
+  // blocks in the size class of a request may be smaller than it; only this
+  // many of them are looked at before moving on to the larger size classes
+  static constexpr std::size_t max_size_class_walk = 8;
+
+  struct oversized_size_classes
+  {
+    std::size_t alignment_log2;
+    std::uint64_t octave_bitmap;
+    std::uint16_t size_class_bitmaps[octave_count];
+    oversized_block_descriptor_ptr free_lists[octave_count * size_classes_per_octave];
+  };
+
+  // unlike the rest of the bookkeeping, this is only ever accessed on the
+  // host, and is kept in host memory, so that looking up a cached block does
+  // not touch any block other than the one it finds
+  using oversized_size_classes_vector = std::vector<oversized_size_classes>;
+
   struct pool
   {
     block_descriptor_ptr free_list;
@@ -214,9 +241,205 @@ private:
   pool_vector m_pools;
   chunk_descriptor_ptr m_allocated;
   oversized_block_descriptor_ptr m_oversized;
-  oversized_block_descriptor_ptr m_cached_oversized;
+  // size classes of cached oversized blocks, one set per alignment, sorted by alignment
+  oversized_size_classes_vector m_cached_oversized;
+
+  pool_statistics m_stats;
+
+  void update_peaks()
+  {
+    m_stats.peak_bytes_in_use   = (std::max)(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+    m_stats.peak_bytes_upstream = (std::max)(m_stats.peak_bytes_upstream, m_stats.bytes_upstream);
+  }
+
+  static std::size_t log2(std::size_t x)
+  {
+    return octave_count - 1 - ::cuda::std::countl_zero(x);
+  }
+
+  static std::size_t size_class(std::size_t size)
+  {
+    const std::size_t octave = log2(size);
+    const std::size_t offset = octave >= size_class_bits ? size >> (octave - size_class_bits)
+                                                         : size << (size_class_bits - octave);
+    return octave * size_classes_per_octave + (offset & (size_classes_per_octave - 1));
+  }
+
+  // returns the first non-empty size class not smaller than first, or the number of size classes if there is none
+  static std::size_t find_size_class(const oversized_size_classes& classes, std::size_t first)
+  {
+    std::size_t octave = first / size_classes_per_octave;
+    if (octave >= octave_count)
+    {
+      return octave_count * size_classes_per_octave;
+    }
+
+    const std::uint32_t in_octave =
+      classes.size_class_bitmaps[octave] & (~std::uint32_t(0) << (first % size_classes_per_octave));
+    if (in_octave)
+    {
+      return octave * size_classes_per_octave + ::cuda::std::countr_zero(in_octave);
+    }
+
+    const std::uint64_t above =
+      octave + 1 < octave_count ? classes.octave_bitmap & (~std::uint64_t(0) << (octave + 1)) : 0;
+    if (!above)
+    {
+      return octave_count * size_classes_per_octave;
+    }
+
+    octave = ::cuda::std::countr_zero(above);
+    return octave * size_classes_per_octave
+         + ::cuda::std::countr_zero(static_cast<std::uint32_t>(classes.size_class_bitmaps[octave]));
+  }
+
+  void push_cached_oversized(oversized_block_descriptor_ptr block, oversized_block_descriptor& desc)
+  {
+    const std::size_t alignment_log2 = log2(desc.alignment);
+
+    std::size_t i = 0;
+    while (i < m_cached_oversized.size() && m_cached_oversized[i].alignment_log2 < alignment_log2)
+    {
+      ++i;
+    }
+
+    if (i == m_cached_oversized.size() || m_cached_oversized[i].alignment_log2 != alignment_log2)
+    {
+      oversized_size_classes empty;
+      empty.alignment_log2 = alignment_log2;
+      empty.octave_bitmap  = 0;
+      for (std::size_t octave = 0; octave < octave_count; ++octave)
+      {
+        empty.size_class_bitmaps[octave] = 0;
+      }
+      for (std::size_t c = 0; c < octave_count * size_classes_per_octave; ++c)
+      {
+        empty.free_lists[c] = oversized_block_descriptor_ptr();
+      }
+      m_cached_oversized.insert(m_cached_oversized.begin() + i, empty);
+    }
+
+    oversized_size_classes& classes = m_cached_oversized[i];
+    const std::size_t c             = size_class(desc.size);
+
+    desc.next_cached      = classes.free_lists[c];
+    classes.free_lists[c] = block;
+    classes.size_class_bitmaps[c / size_classes_per_octave] |=
+      static_cast<std::uint16_t>(1u << (c % size_classes_per_octave));
+    classes.octave_bitmap |= std::uint64_t(1) << (c / size_classes_per_octave);
+  }
+
+  // finds the smallest cached block that fits the request without exceeding the size and alignment cutoff factors,
+  // and removes it from the cache; returns a null pointer if there is none
+  oversized_block_descriptor_ptr pop_cached_oversized(std::size_t bytes, std::size_t alignment)
+  {
+    const std::size_t alignment_log2 = log2(alignment);
+    const std::size_t request_class  = size_class(bytes);
+
+    oversized_size_classes* best_classes     = nullptr;
+    std::size_t best_class                   = 0;
+    oversized_block_descriptor_ptr best_prev = oversized_block_descriptor_ptr();
+    oversized_block_descriptor_ptr best      = oversized_block_descriptor_ptr();
+    std::size_t best_size                    = 0;
+
+    for (std::size_t i = 0; i < m_cached_oversized.size(); ++i)
+    {
+      oversized_size_classes& classes = m_cached_oversized[i];
+      if (classes.alignment_log2 < alignment_log2)
+      {
+        continue;
+      }
+      if ((static_cast<std::size_t>(1) << (classes.alignment_log2 - alignment_log2))
+          >= m_options.cached_alignment_cutoff_factor)
+      {
+        break;
+      }
+
+      // the size class of the request holds blocks both smaller and bigger than it; look at a few of them first
+      bool found = false;
+
+      oversized_block_descriptor_ptr prev = oversized_block_descriptor_ptr();
+      oversized_block_descriptor_ptr ptr  = classes.free_lists[request_class];
+      for (std::size_t walked = 0; oversized_block_ptr_traits::get(ptr) && walked < max_size_class_walk; ++walked)
+      {
+        const std::size_t size = thrust::raw_reference_cast(*ptr).size;
+        if (size >= bytes)
+        {
+          if (!oversized_block_ptr_traits::get(best) || size < best_size)
+          {
+            best_classes = &classes;
+            best_class   = request_class;
+            best_prev    = prev;
+            best         = ptr;
+            best_size    = size;
+          }
+          found = true;
+          break;
+        }
+
+        prev = ptr;
+        ptr  = thrust::raw_reference_cast(*ptr).next_cached;
+      }
+
+      if (found)
+      {
+        continue;
+      }
+
+      // every block in a bigger size class fits
+      const std::size_t c = find_size_class(classes, request_class + 1);
+      if (c == octave_count * size_classes_per_octave)
+      {
+        continue;
+      }
+
+      ptr                    = classes.free_lists[c];
+      const std::size_t size = thrust::raw_reference_cast(*ptr).size;
+      if (!oversized_block_ptr_traits::get(best) || size < best_size)
+      {
+        best_classes = &classes;
+        best_class   = c;
+        best_prev    = oversized_block_descriptor_ptr();
+        best         = ptr;
+        best_size    = size;
+      }
+    }
+
+    if (!oversized_block_ptr_traits::get(best) || best_size / bytes >= m_options.cached_size_cutoff_factor)
+    {
+      return oversized_block_descriptor_ptr();
+    }
+
+    const oversized_block_descriptor_ptr next = thrust::raw_reference_cast(*best).next_cached;
+    if (oversized_block_ptr_traits::get(best_prev))
+    {
+      thrust::raw_reference_cast(*best_prev).next_cached = next;
+    }
+    else
+    {
+      best_classes->free_lists[best_class] = next;
+      if (!oversized_block_ptr_traits::get(next))
+      {
+        std::uint16_t& bitmap = best_classes->size_class_bitmaps[best_class / size_classes_per_octave];
+        bitmap &= static_cast<std::uint16_t>(~(1u << (best_class % size_classes_per_octave)));
+        if (!bitmap)
+        {
+          best_classes->octave_bitmap &= ~(std::uint64_t(1) << (best_class / size_classes_per_octave));
+        }
+      }
+    }
+
+    return best;
+  }
 
 public:
+  /*! Returns a snapshot of the activity of this resource, for tuning its options.
+   */
+  pool_statistics get_stats() const
+  {
+    return m_stats;
+  }
+
   /*! Releases all held memory to upstream.
    */
   void release()
@@ -238,6 +461,7 @@ public:
         static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - thrust::raw_reference_cast(*alloc).size);
       m_upstream->do_deallocate(
         p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+      ++m_stats.upstream_deallocations;
     }
 
     // deallocate cached oversized/overaligned memory
@@ -250,9 +474,14 @@ public:
 
       void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - desc.current_size);
       m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+      ++m_stats.upstream_deallocations;
     }
 
-    m_cached_oversized = oversized_block_descriptor_ptr();
+    m_cached_oversized.clear();
+
+    m_stats.bytes_in_use   = 0;
+    m_stats.bytes_cached   = 0;
+    m_stats.bytes_upstream = 0;
   }
 
   _CCCL_NODISCARD virtual void_ptr
@@ -261,85 +490,54 @@ public:
     bytes = (std::max)(bytes, m_options.smallest_block_size);
     assert(detail::is_power_of_2(alignment));
 
+    ++m_stats.allocations;
+
     // an oversized and/or overaligned allocation requested; needs to be allocated separately
     if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
     {
+      ++m_stats.oversized_allocations;
+
       if (m_options.cache_oversized)
       {
-        oversized_block_descriptor_ptr ptr       = m_cached_oversized;
-        oversized_block_descriptor_ptr* previous = &m_cached_oversized;
-        while (oversized_block_ptr_traits::get(ptr))
+        oversized_block_descriptor_ptr ptr = pop_cached_oversized(bytes, alignment);
+
+        if (oversized_block_ptr_traits::get(ptr))
         {
           oversized_block_descriptor desc = *ptr;
-          bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
+          desc.next_cached                = oversized_block_descriptor_ptr();
 
-          // if the size is bigger than the requested size by a factor
-          // bigger than or equal to the specified cutoff for size,
-          // allocate a new block
-          if (is_good)
-          {
-            std::size_t size_factor = desc.size / bytes;
-            if (size_factor >= m_options.cached_size_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+          auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
 
-          // if the alignment is bigger than the requested one by a factor
-          // bigger than or equal to the specified cutoff for alignment,
-          // allocate a new block
-          if (is_good)
+          if (bytes != desc.size)
           {
-            std::size_t alignment_factor = desc.alignment / alignment;
-            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+            desc.current_size = bytes;
 
-          if (is_good)
-          {
-            if (previous != &m_cached_oversized)
+            ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+
+            if (oversized_block_ptr_traits::get(desc.prev))
             {
-              *previous = desc.next_cached;
+              thrust::raw_reference_cast(*desc.prev).next = ptr;
             }
             else
             {
-              m_cached_oversized = desc.next_cached;
+              m_oversized = ptr;
             }
 
-            desc.next_cached = oversized_block_descriptor_ptr();
-
-            auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
-
-            if (bytes != desc.size)
+            if (oversized_block_ptr_traits::get(desc.next))
             {
-              desc.current_size = bytes;
-
-              ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
-
-              if (oversized_block_ptr_traits::get(desc.prev))
-              {
-                thrust::raw_reference_cast(*desc.prev).next = ptr;
-              }
-              else
-              {
-                m_oversized = ptr;
-              }
-
-              if (oversized_block_ptr_traits::get(desc.next))
-              {
-                thrust::raw_reference_cast(*desc.next).prev = ptr;
-              }
+              thrust::raw_reference_cast(*desc.next).prev = ptr;
             }
+          }
 
-            *ptr = desc;
+          *ptr = desc;
 
-            return static_cast<void_ptr>(ret);
-          }
+          ++m_stats.cache_hits;
+          ++m_stats.oversized_cache_hits;
+          m_stats.bytes_cached -= desc.size;
+          m_stats.bytes_in_use += desc.size;
+          update_peaks();
 
-          previous = &thrust::raw_reference_cast(*ptr).next_cached;
-          ptr      = *previous;
+          return static_cast<void_ptr>(ret);
         }
       }
 
@@ -365,6 +563,11 @@ public:
         *desc.next                      = next;
       }
 
+      ++m_stats.upstream_allocations;
+      m_stats.bytes_upstream += bytes + sizeof(oversized_block_descriptor);
+      m_stats.bytes_in_use += bytes;
+      update_peaks();
+
       return allocated;
     }
 
@@ -427,8 +630,20 @@ public:
         *block           = block_desc;
         bucket.free_list = block;
       }
+
+      ++m_stats.upstream_allocations;
+      m_stats.bytes_upstream += chunk_size + sizeof(chunk_descriptor);
+      m_stats.bytes_cached += n * bytes;
+    }
+    else
+    {
+      ++m_stats.cache_hits;
     }
 
+    m_stats.bytes_cached -= bytes;
+    m_stats.bytes_in_use += bytes;
+    update_peaks();
+
     // allocate a block from the front of the bucket's free list
     block_descriptor_ptr block = bucket.free_list;
     bucket.free_list           = thrust::raw_reference_cast(*block).next;
@@ -443,6 +658,8 @@ public:
     // verify that the pointer is at least as aligned as claimed
     assert(reinterpret_cast<detail::intmax_t>(void_ptr_traits::get(p)) % alignment == 0);
 
+    ++m_stats.deallocations;
+
     // the deallocated block is oversized and/or overaligned
     if (n > m_options.largest_block_size || alignment > m_options.alignment)
     {
@@ -453,10 +670,10 @@ public:
       assert(desc.current_size == n);
       assert(desc.alignment == alignment);
 
+      m_stats.bytes_in_use -= desc.size;
+
       if (m_options.cache_oversized)
       {
-        desc.next_cached = m_cached_oversized;
-
         if (desc.size != n)
         {
           desc.current_size = desc.size;
@@ -477,8 +694,10 @@ public:
           }
         }
 
-        m_cached_oversized = block;
-        *block             = desc;
+        push_cached_oversized(block, desc);
+        *block = desc;
+
+        m_stats.bytes_cached += desc.size;
 
         return;
       }
@@ -499,6 +718,9 @@ public:
 
       m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
 
+      ++m_stats.upstream_deallocations;
+      m_stats.bytes_upstream -= desc.size + sizeof(oversized_block_descriptor);
+
       return;
     }
 
@@ -515,6 +737,9 @@ public:
     desc.next        = bucket.free_list;
     *block           = desc;
     bucket.free_list = block;
+
+    m_stats.bytes_in_use -= n;
+    m_stats.bytes_cached += n;
   }
 };
 
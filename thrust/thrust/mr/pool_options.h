@@ -98,6 +98,22 @@ struct pool_options
    */
   std::size_t cached_alignment_cutoff_factor;
 
+  /*! The maximal number of bytes in blocks cached by a single thread in front of the shared pool, by the resources in
+   *      \p tls_pool.h and \p disjoint_tls_pool.h. A thread whose cache grows past this size returns blocks to the
+   *      shared pool. If zero, threads do not cache blocks, and every request goes to the shared pool.
+   */
+  std::size_t max_bytes_per_thread_cache;
+  /*! The number of allocations and deallocations made by a thread after which its cache is trimmed: half of the blocks
+   *      of each size that the thread has not used since the previous trim are returned to the shared pool. If zero,
+   *      thread caches are only trimmed when they grow past \p max_bytes_per_thread_cache.
+   */
+  std::size_t thread_cache_trim_interval;
+  /*! The maximal number of batches of blocks of a given size that threads returning blocks keep in a queue for threads
+   *      allocating blocks of that size, so that blocks freed by one thread reach another without going through the
+   *      shared pool. If zero, returned blocks always go to the shared pool.
+   */
+  std::size_t max_remote_free_batches;
+
   /*! Checks if the options are self-consistent.
    *
    *  /returns true if the options are self-consitent, false otherwise.
@@ -167,6 +183,53 @@ struct pool_options
   }
 };
 
+/*! A snapshot of the activity of a pooling resource adaptor, as returned by its \p get_stats member function, meant for
+ *      tuning its \p pool_options. All sizes are in bytes.
+ */
+struct pool_statistics
+{
+  /*! The number of allocation requests.
+   */
+  std::size_t allocations;
+  /*! The number of deallocation requests.
+   */
+  std::size_t deallocations;
+  /*! The number of allocation requests fulfilled with memory already held by the pool, without calling upstream. The
+   *      hit rate of the pool is <tt>cache_hits / allocations</tt>.
+   */
+  std::size_t cache_hits;
+  /*! The number of allocation requests for oversized or overaligned blocks.
+   */
+  std::size_t oversized_allocations;
+  /*! The number of allocation requests for oversized or overaligned blocks fulfilled with a cached block.
+   */
+  std::size_t oversized_cache_hits;
+
+  /*! The number of allocations made from upstream, for chunks of pooled blocks and for oversized blocks.
+   */
+  std::size_t upstream_allocations;
+  /*! The number of deallocations made to upstream.
+   */
+  std::size_t upstream_deallocations;
+
+  /*! The size of the blocks currently handed out. Pooled blocks count with their size rounded up to their pool's, and
+   *      cached oversized blocks with their full size.
+   */
+  std::size_t bytes_in_use;
+  /*! The highest value \p bytes_in_use has had.
+   */
+  std::size_t peak_bytes_in_use;
+  /*! The size of the blocks currently held for reuse.
+   */
+  std::size_t bytes_cached;
+  /*! The size of the memory currently allocated from upstream, including any bookkeeping the pool keeps in it.
+   */
+  std::size_t bytes_upstream;
+  /*! The highest value \p bytes_upstream has had.
+   */
+  std::size_t peak_bytes_upstream;
+};
+
 /*! \} // memory_resources
  */
 
@@ -0,0 +1,295 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A synchronized pool resource that scales with the number of threads, by caching blocks in per-thread shards
+ *      in front of a shared, mutex-synchronized \p unsynchronized_pool_resource.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/pool.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+namespace detail
+{
+
+// A small integer identifying the calling thread, assigned in the order in which threads first ask for it.
+inline std::size_t this_thread_shard_hint()
+{
+  static std::atomic<std::size_t> next_hint(0);
+  static thread_local std::size_t hint = next_hint++;
+  return hint;
+}
+
+/*! The common implementation of \p sharded_pool_resource and \p disjoint_sharded_pool_resource.
+ *
+ *  Blocks that fit the pools are cached in one of a number of shards, picked by the calling thread, each guarded by
+ *  its own mutex. A shard whose cache for a size is empty takes a batch of blocks from the shared pool, the depot, and
+ *  one that caches more than two batches gives a batch back, so the depot's mutex is taken once per batch rather than
+ *  once per call. Oversized and overaligned allocations go straight to the depot.
+ *
+ *  \tparam Pool the type of the unsynchronized pool used as the depot
+ */
+template <typename Pool>
+class sharded_pool_base : public memory_resource<typename Pool::pointer>
+{
+  using lock_t   = std::lock_guard<std::mutex>;
+  using void_ptr = typename Pool::pointer;
+
+  struct shard
+  {
+    std::mutex mtx;
+    std::vector<std::vector<void_ptr>> free_lists;
+
+    // keep shards used by different threads on separate cache lines
+    char padding[64];
+  };
+
+public:
+  /*! Releases all held memory to upstream, including the blocks cached by every shard.
+   */
+  void release()
+  {
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(m_shard_count);
+
+    for (std::size_t i = 0; i < m_shard_count; ++i)
+    {
+      locks.emplace_back(m_shards[i].mtx);
+      for (std::vector<void_ptr>& free_list : m_shards[i].free_lists)
+      {
+        free_list.clear();
+      }
+    }
+
+    lock_t lock(m_depot_mtx);
+    m_depot.release();
+  }
+
+  /*! Returns a snapshot of the activity of the shared pool behind the shard caches, for tuning its options. Requests
+   *      served by a shard cache do not reach the shared pool, and blocks held by the shard caches count as in use.
+   */
+  pool_statistics get_stats()
+  {
+    lock_t lock(m_depot_mtx);
+    return m_depot.get_stats();
+  }
+
+  _CCCL_NODISCARD virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes = (std::max)(bytes, m_options.smallest_block_size);
+
+    if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_depot_mtx);
+      return m_depot.do_allocate(bytes, alignment);
+    }
+
+    const std::size_t bytes_log2 = thrust::detail::log2_ri(bytes);
+    const std::size_t bucket_idx = bytes_log2 - m_smallest_block_log2;
+
+    shard& s = this_thread_shard();
+    lock_t lock(s.mtx);
+
+    std::vector<void_ptr>& free_list = s.free_lists[bucket_idx];
+    if (free_list.empty())
+    {
+      refill(free_list, bytes_log2);
+    }
+
+    void_ptr ret = free_list.back();
+    free_list.pop_back();
+    return ret;
+  }
+
+  virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    n = (std::max)(n, m_options.smallest_block_size);
+
+    if (n > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_depot_mtx);
+      m_depot.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    const std::size_t n_log2     = thrust::detail::log2_ri(n);
+    const std::size_t bucket_idx = n_log2 - m_smallest_block_log2;
+
+    shard& s = this_thread_shard();
+    lock_t lock(s.mtx);
+
+    std::vector<void_ptr>& free_list = s.free_lists[bucket_idx];
+    free_list.push_back(p);
+
+    const std::size_t batch = batch_size(n_log2);
+    if (free_list.size() > 2 * batch)
+    {
+      lock_t depot_lock(m_depot_mtx);
+      for (std::size_t i = 0; i < batch; ++i)
+      {
+        m_depot.do_deallocate(free_list.back(), std::size_t(1) << n_log2, m_options.alignment);
+        free_list.pop_back();
+      }
+    }
+  }
+
+protected:
+  template <typename... Args>
+  sharded_pool_base(pool_options options, Args&&... args)
+      : m_options(options)
+      , m_smallest_block_log2(thrust::detail::log2_ri(m_options.smallest_block_size))
+      , m_shard_count(default_shard_count())
+      , m_shards(new shard[m_shard_count])
+      , m_depot(std::forward<Args>(args)..., options)
+  {
+    const std::size_t bucket_count = thrust::detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1;
+
+    for (std::size_t i = 0; i < m_shard_count; ++i)
+    {
+      m_shards[i].free_lists.resize(bucket_count);
+    }
+  }
+
+  ~sharded_pool_base()
+  {
+    release();
+  }
+
+private:
+  static std::size_t default_shard_count()
+  {
+    const std::size_t threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+    std::size_t ret = 1;
+    while (ret < threads)
+    {
+      ret *= 2;
+    }
+    return ret;
+  }
+
+  shard& this_thread_shard()
+  {
+    return m_shards[this_thread_shard_hint() & (m_shard_count - 1)];
+  }
+
+  // The number of blocks moved between a shard and the depot at once: a chunk's worth, as in the depot's first chunk
+  // for the size, but no more than min_bytes_per_chunk for large blocks.
+  std::size_t batch_size(std::size_t bytes_log2) const
+  {
+    const std::size_t by_bytes = m_options.min_bytes_per_chunk >> bytes_log2;
+    return (std::max)((std::min)(m_options.min_blocks_per_chunk, by_bytes), std::size_t(1));
+  }
+
+  void refill(std::vector<void_ptr>& free_list, std::size_t bytes_log2)
+  {
+    const std::size_t batch = batch_size(bytes_log2);
+    free_list.reserve(2 * batch + 1);
+
+    lock_t lock(m_depot_mtx);
+    for (std::size_t i = 0; i < batch; ++i)
+    {
+      free_list.push_back(m_depot.do_allocate(std::size_t(1) << bytes_log2, m_options.alignment));
+    }
+  }
+
+  pool_options m_options;
+  std::size_t m_smallest_block_log2;
+
+  std::size_t m_shard_count;
+  std::unique_ptr<shard[]> m_shards;
+
+  std::mutex m_depot_mtx;
+  Pool m_depot;
+};
+
+} // namespace detail
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A synchronized version of \p unsynchronized_pool_resource that scales with the number of threads using it.
+ *
+ *  Where \p synchronized_pool_resource serializes every call on a single mutex, this resource caches blocks in
+ *  per-thread shards (as many as there are hardware threads), which take blocks from and return them to a shared pool
+ *  in batches. Allocations that are oversized or overaligned according to the pool options go to the shared pool
+ *  directly, and are cached according to the same options. A block may be deallocated by a different thread than the
+ *  one that allocated it. Uses \p std::mutex, and therefore requires C++11.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template <typename Upstream>
+class sharded_pool_resource final : public detail::sharded_pool_base<unsynchronized_pool_resource<Upstream>>
+{
+  using base = detail::sharded_pool_base<unsynchronized_pool_resource<Upstream>>;
+
+public:
+  /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return unsynchronized_pool_resource<Upstream>::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param options pool options to use
+   */
+  sharded_pool_resource(Upstream* upstream, pool_options options = get_default_options())
+      : base(options, upstream)
+  {}
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param options pool options to use
+   */
+  sharded_pool_resource(pool_options options = get_default_options())
+      : base(options, get_global_resource<Upstream>())
+  {}
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -0,0 +1,279 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A memory resource adaptor that counts the allocations and deallocations made through it.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The number of entries in the size histogram of \p allocation_statistics.
+ */
+constexpr std::size_t allocation_size_histogram_size = sizeof(std::size_t) * 8 + 1;
+
+/*! A snapshot of the counters of a \p statistics_resource. All sizes are in bytes.
+ */
+struct allocation_statistics
+{
+  /*! The number of allocations.
+   */
+  std::size_t allocations;
+  /*! The number of deallocations.
+   */
+  std::size_t deallocations;
+  /*! The total size of all allocations.
+   */
+  std::size_t bytes_allocated;
+  /*! The total size of all deallocations.
+   */
+  std::size_t bytes_deallocated;
+  /*! The size of the memory currently allocated.
+   */
+  std::size_t bytes_in_use;
+  /*! The highest value \p bytes_in_use has had.
+   */
+  std::size_t peak_bytes_in_use;
+  /*! The number of allocations of each size, if the resource keeps a size histogram, and zeroes otherwise. Entry \p i
+   *      counts the allocations of more than <tt>2^(i-1)</tt> and at most <tt>2^i</tt> bytes; entry 0 counts the
+   *      allocations of at most one byte.
+   */
+  std::size_t size_histogram[allocation_size_histogram_size];
+};
+
+/*! The kind of call reported to the tracing hook of a \p statistics_resource.
+ */
+enum class allocation_event_kind
+{
+  allocate,
+  deallocate
+};
+
+/*! A single call reported to the tracing hook of a \p statistics_resource.
+ */
+struct allocation_event
+{
+  /*! Whether the call was an allocation or a deallocation.
+   */
+  allocation_event_kind kind;
+  /*! The raw address of the allocated or deallocated memory.
+   */
+  const void* pointer;
+  /*! The size of the allocated or deallocated memory.
+   */
+  std::size_t bytes;
+  /*! The alignment of the allocated or deallocated memory.
+   */
+  std::size_t alignment;
+};
+
+/*! A memory resource adaptor that forwards all calls to its upstream resource, and keeps count of them. The counters
+ *      are relaxed atomics, cheap enough to leave on in production, and are read with \p get_stats. Optionally, the
+ *      resource also keeps a histogram of allocation sizes, and calls a user supplied tracing hook on every
+ *      allocation and deallocation.
+ *
+ *  Placed between a pooling resource and its upstream, it shows how much memory the pool really takes from the
+ *      system; placed in front of one, how the requests the pool sees are distributed. Thread safe if the upstream
+ *      resource and the tracing hook are.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocations
+ */
+template <typename Upstream>
+class statistics_resource final
+    : public memory_resource<typename Upstream::pointer>
+    , private validator<Upstream>
+{
+  using void_ptr = typename Upstream::pointer;
+
+public:
+  /*! The type of the tracing hook.
+   */
+  using trace_hook = std::function<void(const allocation_event&)>;
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param size_histogram whether to keep a histogram of allocation sizes
+   */
+  statistics_resource(Upstream* upstream, bool size_histogram = false)
+      : m_upstream(upstream)
+      , m_allocations(0)
+      , m_deallocations(0)
+      , m_bytes_allocated(0)
+      , m_bytes_deallocated(0)
+      , m_bytes_in_use(0)
+      , m_peak_bytes_in_use(0)
+      , m_size_histogram(size_histogram ? new std::atomic<std::size_t>[allocation_size_histogram_size]() : nullptr)
+  {}
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param size_histogram whether to keep a histogram of allocation sizes
+   */
+  statistics_resource(bool size_histogram = false)
+      : statistics_resource(get_global_resource<Upstream>(), size_histogram)
+  {}
+
+  statistics_resource(const statistics_resource&)            = delete;
+  statistics_resource& operator=(const statistics_resource&) = delete;
+
+  /*! Returns the upstream memory resource for allocations.
+   */
+  Upstream* upstream_resource() const
+  {
+    return m_upstream;
+  }
+
+  /*! Sets the function called after every allocation and before every deallocation. Must not be called while other
+   *      threads allocate or deallocate through this resource.
+   *
+   *  \param hook the tracing hook, or an empty function to stop tracing
+   */
+  void set_trace_hook(trace_hook hook)
+  {
+    m_trace_hook = std::move(hook);
+  }
+
+  /*! Returns a snapshot of the counters of this resource. Counters updated concurrently with this call may or may not
+   *      be reflected in it.
+   */
+  allocation_statistics get_stats() const
+  {
+    allocation_statistics ret;
+    ret.allocations       = m_allocations.load(std::memory_order_relaxed);
+    ret.deallocations     = m_deallocations.load(std::memory_order_relaxed);
+    ret.bytes_allocated   = m_bytes_allocated.load(std::memory_order_relaxed);
+    ret.bytes_deallocated = m_bytes_deallocated.load(std::memory_order_relaxed);
+    ret.bytes_in_use      = m_bytes_in_use.load(std::memory_order_relaxed);
+    ret.peak_bytes_in_use = m_peak_bytes_in_use.load(std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < allocation_size_histogram_size; ++i)
+    {
+      ret.size_histogram[i] = m_size_histogram ? m_size_histogram[i].load(std::memory_order_relaxed) : 0;
+    }
+
+    return ret;
+  }
+
+  /*! Resets all counters to zero, except for \p bytes_in_use, which keeps tracking the memory currently allocated,
+   *      and \p peak_bytes_in_use, which restarts from it.
+   */
+  void reset_stats()
+  {
+    m_allocations.store(0, std::memory_order_relaxed);
+    m_deallocations.store(0, std::memory_order_relaxed);
+    m_bytes_allocated.store(0, std::memory_order_relaxed);
+    m_bytes_deallocated.store(0, std::memory_order_relaxed);
+    m_peak_bytes_in_use.store(m_bytes_in_use.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    if (m_size_histogram)
+    {
+      for (std::size_t i = 0; i < allocation_size_histogram_size; ++i)
+      {
+        m_size_histogram[i].store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  _CCCL_NODISCARD virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    void_ptr ret = m_upstream->do_allocate(bytes, alignment);
+
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    m_bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+
+    const std::size_t in_use = m_bytes_in_use.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::size_t peak         = m_peak_bytes_in_use.load(std::memory_order_relaxed);
+    while (peak < in_use && !m_peak_bytes_in_use.compare_exchange_weak(peak, in_use, std::memory_order_relaxed))
+    {}
+
+    if (m_size_histogram)
+    {
+      m_size_histogram[bytes > 1 ? thrust::detail::log2_ri(bytes) : 0].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (m_trace_hook)
+    {
+      m_trace_hook(allocation_event{allocation_event_kind::allocate, thrust::raw_pointer_cast(ret), bytes, alignment});
+    }
+
+    return ret;
+  }
+
+  virtual void
+  do_deallocate(void_ptr p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    if (m_trace_hook)
+    {
+      m_trace_hook(allocation_event{allocation_event_kind::deallocate, thrust::raw_pointer_cast(p), bytes, alignment});
+    }
+
+    m_deallocations.fetch_add(1, std::memory_order_relaxed);
+    m_bytes_deallocated.fetch_add(bytes, std::memory_order_relaxed);
+    m_bytes_in_use.fetch_sub(bytes, std::memory_order_relaxed);
+
+    m_upstream->do_deallocate(p, bytes, alignment);
+  }
+
+private:
+  Upstream* m_upstream;
+
+  std::atomic<std::size_t> m_allocations;
+  std::atomic<std::size_t> m_deallocations;
+  std::atomic<std::size_t> m_bytes_allocated;
+  std::atomic<std::size_t> m_bytes_deallocated;
+  std::atomic<std::size_t> m_bytes_in_use;
+  std::atomic<std::size_t> m_peak_bytes_in_use;
+
+  std::unique_ptr<std::atomic<std::size_t>[]> m_size_histogram;
+
+  trace_hook m_trace_hook;
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -89,6 +89,14 @@ public:
     upstream_pool.release();
   }
 
+  /*! Returns a snapshot of the activity of this resource, for tuning its options.
+   */
+  pool_statistics get_stats()
+  {
+    lock_t lock(mtx);
+    return upstream_pool.get_stats();
+  }
+
   _CCCL_NODISCARD virtual void_ptr
   do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
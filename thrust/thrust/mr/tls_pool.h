@@ -15,7 +15,8 @@
  */
 
 /*! \file tls_pool.h
- *  \brief A function wrapping a thread local instance of a \p unsynchronized_pool_resource.
+ *  \brief A function wrapping a thread local instance of a \p unsynchronized_pool_resource, and a synchronized pool
+ *      resource that caches blocks per thread in front of a shared \p unsynchronized_pool_resource.
  */
 
 #pragma once
@@ -31,6 +32,15 @@
 #endif // no system header
 #include <thrust/mr/pool.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 THRUST_NAMESPACE_BEGIN
 namespace mr
 {
@@ -44,6 +54,9 @@ namespace mr
 /*! Potentially constructs, if not yet created, and then returns the address of a thread-local \p
  * unsynchronized_pool_resource,
  *
+ *  Blocks cached by the returned pool are only ever reused by the thread that created it; see \p tls_pool_resource
+ *  for a pool whose per-thread caches are bounded and shared between threads.
+ *
  *  \tparam Upstream the template argument to the pool template
  *  \param upstream the argument to the constructor, if invoked
  */
@@ -61,5 +74,477 @@ _CCCL_HOST thrust::mr::unsynchronized_pool_resource<Upstream>& tls_pool(Upstream
 /*! \}
  */
 
+namespace detail
+{
+
+// The part of a thread's cache in a thread-caching pool that the thread itself needs to know about.
+struct thread_cache_base
+{
+  std::mutex mtx;
+  bool orphaned = false;
+};
+
+// The caches the calling thread has in thread-caching pools, by pool. When the thread exits, its caches are marked
+// orphaned, so that their pools give their blocks back the next time they look for orphans.
+class thread_cache_registry
+{
+  struct entry
+  {
+    std::uint64_t pool_id;
+    thread_cache_base* cache;
+    std::weak_ptr<thread_cache_base> lifetime;
+  };
+
+public:
+  ~thread_cache_registry()
+  {
+    for (entry& e : m_entries)
+    {
+      if (std::shared_ptr<thread_cache_base> cache = e.lifetime.lock())
+      {
+        std::lock_guard<std::mutex> lock(cache->mtx);
+        cache->orphaned = true;
+      }
+    }
+  }
+
+  static thread_cache_registry& get()
+  {
+    static thread_local thread_cache_registry registry;
+    return registry;
+  }
+
+  thread_cache_base* find(std::uint64_t pool_id) const
+  {
+    for (const entry& e : m_entries)
+    {
+      if (e.pool_id == pool_id)
+      {
+        return e.cache;
+      }
+    }
+    return nullptr;
+  }
+
+  void insert(std::uint64_t pool_id, const std::shared_ptr<thread_cache_base>& cache)
+  {
+    // forget the caches of pools that have been destroyed since
+    m_entries.erase(std::remove_if(m_entries.begin(),
+                                   m_entries.end(),
+                                   [](const entry& e) {
+                                     return e.lifetime.expired();
+                                   }),
+                    m_entries.end());
+    m_entries.push_back(entry{pool_id, cache.get(), cache});
+  }
+
+private:
+  std::vector<entry> m_entries;
+};
+
+// Pool ids are never reused, so that a thread cannot mistake a new pool for a destroyed one at the same address.
+inline std::uint64_t next_thread_caching_pool_id()
+{
+  static std::atomic<std::uint64_t> next_id(0);
+  return next_id++;
+}
+
+/*! The common implementation of \p tls_pool_resource and \p disjoint_tls_pool_resource.
+ *
+ *  Every thread that uses the resource gets its own cache of blocks of each size, in front of a shared pool, the
+ *  depot. A thread whose cache of a size is empty takes a batch of blocks, preferably from the remote free queue of
+ *  that size, in which other threads leave the blocks they give back, and otherwise from the depot. A thread whose
+ *  cache grows past \p pool_options::max_bytes_per_thread_cache gives a batch back, and every
+ *  \p pool_options::thread_cache_trim_interval calls a thread gives back half of the blocks it has not used since
+ *  the last time. The caches of threads that have exited are given back when the resource next looks for them,
+ *  which is when a thread trims its cache or uses the resource for the first time.
+ *
+ *  \tparam Pool the type of the unsynchronized pool used as the depot
+ */
+template <typename Pool>
+class thread_caching_pool_base : public memory_resource<typename Pool::pointer>
+{
+  using lock_t   = std::lock_guard<std::mutex>;
+  using void_ptr = typename Pool::pointer;
+
+  struct size_class
+  {
+    std::vector<void_ptr> blocks;
+    // the fewest blocks cached since the last trim; that many blocks have not been used since
+    std::size_t low_water = 0;
+  };
+
+  struct thread_cache : thread_cache_base
+  {
+    std::vector<size_class> classes;
+    std::size_t bytes = 0;
+    std::size_t calls = 0;
+  };
+
+  struct remote_free_queue
+  {
+    std::mutex mtx;
+    std::vector<std::vector<void_ptr>> batches;
+  };
+
+public:
+  /*! Releases all held memory to upstream, including the blocks cached by every thread.
+   */
+  void release()
+  {
+    lock_t registry_lock(m_registry_mtx);
+
+    for (const std::shared_ptr<thread_cache>& cache : m_caches)
+    {
+      lock_t lock(cache->mtx);
+      for (size_class& c : cache->classes)
+      {
+        c.blocks.clear();
+        c.low_water = 0;
+      }
+      cache->bytes = 0;
+    }
+
+    for (std::size_t i = 0; i < m_bucket_count; ++i)
+    {
+      lock_t lock(m_remote_frees[i].mtx);
+      m_remote_frees[i].batches.clear();
+    }
+
+    lock_t depot_lock(m_depot_mtx);
+    m_depot.release();
+  }
+
+  /*! Returns a snapshot of the activity of the shared pool behind the thread caches, for tuning its options. Requests
+   *      served by a thread cache do not reach the shared pool, and blocks held by the thread caches count as in use.
+   */
+  pool_statistics get_stats()
+  {
+    lock_t lock(m_depot_mtx);
+    return m_depot.get_stats();
+  }
+
+  _CCCL_NODISCARD virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes = (std::max)(bytes, m_options.smallest_block_size);
+
+    if (bytes > m_options.largest_block_size || alignment > m_options.alignment
+        || m_options.max_bytes_per_thread_cache == 0)
+    {
+      lock_t lock(m_depot_mtx);
+      return m_depot.do_allocate(bytes, alignment);
+    }
+
+    const std::size_t bytes_log2 = thrust::detail::log2_ri(bytes);
+    const std::size_t bucket_idx = bytes_log2 - m_smallest_block_log2;
+
+    thread_cache& cache = this_thread_cache();
+    bool trim_due;
+    void_ptr ret;
+
+    {
+      lock_t lock(cache.mtx);
+
+      size_class& c = cache.classes[bucket_idx];
+      if (c.blocks.empty())
+      {
+        refill(cache, bucket_idx);
+      }
+
+      ret = c.blocks.back();
+      c.blocks.pop_back();
+      cache.bytes -= std::size_t(1) << bytes_log2;
+      c.low_water = (std::min)(c.low_water, c.blocks.size());
+
+      trim_due = count_call(cache);
+    }
+
+    if (trim_due)
+    {
+      collect_orphans();
+    }
+
+    return ret;
+  }
+
+  virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    n = (std::max)(n, m_options.smallest_block_size);
+
+    if (n > m_options.largest_block_size || alignment > m_options.alignment
+        || m_options.max_bytes_per_thread_cache == 0)
+    {
+      lock_t lock(m_depot_mtx);
+      m_depot.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    const std::size_t n_log2     = thrust::detail::log2_ri(n);
+    const std::size_t bucket_idx = n_log2 - m_smallest_block_log2;
+
+    thread_cache& cache = this_thread_cache();
+    bool trim_due;
+
+    {
+      lock_t lock(cache.mtx);
+
+      cache.classes[bucket_idx].blocks.push_back(p);
+      cache.bytes += std::size_t(1) << n_log2;
+
+      if (cache.bytes > m_options.max_bytes_per_thread_cache)
+      {
+        give_back(cache, bucket_idx, batch_size(n_log2));
+
+        // if other sizes hold most of the cache, give those back too, largest first
+        for (std::size_t i = m_bucket_count; i > 0 && cache.bytes > m_options.max_bytes_per_thread_cache; --i)
+        {
+          give_back(cache, i - 1, cache.classes[i - 1].blocks.size());
+        }
+      }
+
+      trim_due = count_call(cache);
+    }
+
+    if (trim_due)
+    {
+      collect_orphans();
+    }
+  }
+
+protected:
+  template <typename... Args>
+  thread_caching_pool_base(pool_options options, Args&&... args)
+      : m_options(options)
+      , m_smallest_block_log2(thrust::detail::log2_ri(m_options.smallest_block_size))
+      , m_bucket_count(thrust::detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1)
+      , m_id(next_thread_caching_pool_id())
+      , m_remote_frees(new remote_free_queue[m_bucket_count])
+      , m_depot(std::forward<Args>(args)..., options)
+  {}
+
+  ~thread_caching_pool_base()
+  {
+    release();
+  }
+
+private:
+  thread_cache& this_thread_cache()
+  {
+    thread_cache_registry& registry = thread_cache_registry::get();
+    if (thread_cache_base* cache = registry.find(m_id))
+    {
+      return static_cast<thread_cache&>(*cache);
+    }
+
+    std::shared_ptr<thread_cache> cache = std::make_shared<thread_cache>();
+    cache->classes.resize(m_bucket_count);
+
+    {
+      lock_t lock(m_registry_mtx);
+      collect_orphans_locked();
+      m_caches.push_back(cache);
+    }
+
+    registry.insert(m_id, cache);
+    return *cache;
+  }
+
+  // The number of blocks moved between a thread's cache and the shared pool at once: a chunk's worth, as in the
+  // depot's first chunk for the size, but no more than min_bytes_per_chunk for large blocks, nor than fits the cache.
+  std::size_t batch_size(std::size_t bytes_log2) const
+  {
+    const std::size_t by_bytes = m_options.min_bytes_per_chunk >> bytes_log2;
+    const std::size_t by_cache = m_options.max_bytes_per_thread_cache >> bytes_log2;
+    return (std::max)((std::min)({m_options.min_blocks_per_chunk, by_bytes, by_cache}), std::size_t(1));
+  }
+
+  void refill(thread_cache& cache, std::size_t bucket_idx)
+  {
+    const std::size_t bytes_log2 = bucket_idx + m_smallest_block_log2;
+    std::vector<void_ptr>& blocks = cache.classes[bucket_idx].blocks;
+
+    std::vector<void_ptr> batch;
+    if (m_options.max_remote_free_batches > 0)
+    {
+      remote_free_queue& queue = m_remote_frees[bucket_idx];
+      lock_t lock(queue.mtx);
+      if (!queue.batches.empty())
+      {
+        batch = std::move(queue.batches.back());
+        queue.batches.pop_back();
+      }
+    }
+
+    if (batch.empty())
+    {
+      const std::size_t count = batch_size(bytes_log2);
+      batch.reserve(count);
+
+      lock_t lock(m_depot_mtx);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        batch.push_back(m_depot.do_allocate(std::size_t(1) << bytes_log2, m_options.alignment));
+      }
+    }
+
+    cache.bytes += batch.size() << bytes_log2;
+    blocks.insert(blocks.end(), batch.begin(), batch.end());
+  }
+
+  // Moves the last count blocks of a size out of a thread's cache, into the remote free queue if it has room for
+  // another batch, and into the depot otherwise.
+  void give_back(thread_cache& cache, std::size_t bucket_idx, std::size_t count)
+  {
+    const std::size_t bytes_log2 = bucket_idx + m_smallest_block_log2;
+    size_class& c                = cache.classes[bucket_idx];
+
+    count = (std::min)(count, c.blocks.size());
+    if (count == 0)
+    {
+      return;
+    }
+
+    std::vector<void_ptr> batch(c.blocks.end() - count, c.blocks.end());
+    c.blocks.resize(c.blocks.size() - count);
+    c.low_water = (std::min)(c.low_water, c.blocks.size());
+    cache.bytes -= count << bytes_log2;
+
+    if (m_options.max_remote_free_batches > 0)
+    {
+      remote_free_queue& queue = m_remote_frees[bucket_idx];
+      lock_t lock(queue.mtx);
+      if (queue.batches.size() < m_options.max_remote_free_batches)
+      {
+        queue.batches.push_back(std::move(batch));
+        return;
+      }
+    }
+
+    lock_t lock(m_depot_mtx);
+    for (void_ptr p : batch)
+    {
+      m_depot.do_deallocate(p, std::size_t(1) << bytes_log2, m_options.alignment);
+    }
+  }
+
+  // Counts a call made by the owner of a cache, trimming the cache every thread_cache_trim_interval calls. Returns
+  // whether it did, in which case the caller should also collect orphaned caches, after unlocking its own.
+  bool count_call(thread_cache& cache)
+  {
+    if (m_options.thread_cache_trim_interval == 0 || ++cache.calls < m_options.thread_cache_trim_interval)
+    {
+      return false;
+    }
+
+    cache.calls = 0;
+    for (std::size_t i = 0; i < m_bucket_count; ++i)
+    {
+      give_back(cache, i, (cache.classes[i].low_water + 1) / 2);
+      cache.classes[i].low_water = cache.classes[i].blocks.size();
+    }
+
+    return true;
+  }
+
+  void collect_orphans()
+  {
+    lock_t lock(m_registry_mtx);
+    collect_orphans_locked();
+  }
+
+  void collect_orphans_locked()
+  {
+    for (auto it = m_caches.begin(); it != m_caches.end();)
+    {
+      thread_cache& cache = **it;
+      bool orphaned;
+
+      {
+        lock_t lock(cache.mtx);
+        orphaned = cache.orphaned;
+        if (orphaned)
+        {
+          for (std::size_t i = 0; i < m_bucket_count; ++i)
+          {
+            give_back(cache, i, cache.classes[i].blocks.size());
+          }
+        }
+      }
+
+      it = orphaned ? m_caches.erase(it) : it + 1;
+    }
+  }
+
+  pool_options m_options;
+  std::size_t m_smallest_block_log2;
+  std::size_t m_bucket_count;
+  std::uint64_t m_id;
+
+  std::mutex m_registry_mtx;
+  std::vector<std::shared_ptr<thread_cache>> m_caches;
+
+  std::unique_ptr<remote_free_queue[]> m_remote_frees;
+
+  std::mutex m_depot_mtx;
+  Pool m_depot;
+};
+
+} // namespace detail
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A synchronized version of \p unsynchronized_pool_resource that caches blocks per thread.
+ *
+ *  Unlike the pools returned by \p tls_pool, all threads using this resource share a single pool, in front of which
+ *  each thread caches up to \p pool_options::max_bytes_per_thread_cache bytes of blocks. A block may be deallocated
+ *  by a different thread than the one that allocated it: the deallocating thread caches it, and gives it back to the
+ *  shared pool, through a queue from which threads allocating blocks of the same size take them first, when its cache
+ *  grows too big or when the cache is trimmed. Caches are trimmed every \p pool_options::thread_cache_trim_interval
+ *  calls, and given back when their thread exits. Allocations that are oversized or overaligned according to the pool
+ *  options go to the shared pool directly, and are cached according to the same options. Uses \p std::mutex, and
+ *  therefore requires C++11.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template <typename Upstream>
+class tls_pool_resource final : public detail::thread_caching_pool_base<unsynchronized_pool_resource<Upstream>>
+{
+  using base = detail::thread_caching_pool_base<unsynchronized_pool_resource<Upstream>>;
+
+public:
+  /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return unsynchronized_pool_resource<Upstream>::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param options pool options to use
+   */
+  tls_pool_resource(Upstream* upstream, pool_options options = get_default_options())
+      : base(options, upstream)
+  {}
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param options pool options to use
+   */
+  tls_pool_resource(pool_options options = get_default_options())
+      : base(options, get_global_resource<Upstream>())
+  {}
+};
+
+/*! \} // memory_resources
+ */
+
 } // namespace mr
 THRUST_NAMESPACE_END
@@ -30,6 +30,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/execution_policy.h>
+#include <thrust/detail/radix_decomposer.h>
 
 THRUST_NAMESPACE_BEGIN
 
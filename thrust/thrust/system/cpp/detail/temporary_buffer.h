@@ -26,4 +26,62 @@
 #  pragma system_header
 #endif // no system header
 
-// this system has no special temporary buffer functions
+// By default, this system has no special temporary buffer functions, and temporary buffers are allocated with
+// std::malloc. If THRUST_CACHE_HOST_TEMPORARY_ALLOCATIONS is defined, they are instead taken from a pool owned by the
+// calling thread, so that algorithms called repeatedly with the same sizes stop allocating from the system after
+// their first call. The pool keeps up to THRUST_HOST_CACHING_RESOURCE_MAX_BYTES_CACHED bytes of freed memory until the
+// thread exits; see thrust/detail/host_caching_resource.h. The macros must be defined the same way in all translation
+// units of a program.
+#if defined(THRUST_CACHE_HOST_TEMPORARY_ALLOCATIONS)
+
+#  include <thrust/detail/config/memory_resource.h>
+#  include <thrust/detail/host_caching_resource.h>
+#  include <thrust/detail/pointer.h>
+#  include <thrust/detail/raw_pointer_cast.h>
+#  include <thrust/pair.h>
+#  include <thrust/system/cpp/detail/execution_policy.h>
+
+#  include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace cpp
+{
+namespace detail
+{
+
+template <typename T>
+constexpr std::size_t temporary_buffer_alignment()
+{
+  return alignof(T) > THRUST_MR_DEFAULT_ALIGNMENT ? alignof(T) : THRUST_MR_DEFAULT_ALIGNMENT;
+}
+
+// also used by the omp and tbb systems, whose execution policies derive from this one
+template <typename T, typename DerivedPolicy>
+_CCCL_HOST thrust::pair<thrust::pointer<T, DerivedPolicy>, typename thrust::pointer<T, DerivedPolicy>::difference_type>
+get_temporary_buffer(execution_policy<DerivedPolicy>&, typename thrust::pointer<T, DerivedPolicy>::difference_type n)
+{
+  void* ptr = thrust::detail::host_tls_caching_resource().do_allocate(n * sizeof(T), temporary_buffer_alignment<T>());
+
+  return thrust::make_pair(thrust::pointer<T, DerivedPolicy>(static_cast<T*>(ptr)), n);
+} // end get_temporary_buffer()
+
+template <typename DerivedPolicy, typename Pointer>
+_CCCL_HOST void return_temporary_buffer(execution_policy<DerivedPolicy>&, Pointer p, std::ptrdiff_t n)
+{
+  using T = typename thrust::detail::pointer_traits<Pointer>::element_type;
+
+  if (thrust::raw_pointer_cast(p))
+  {
+    thrust::detail::host_tls_caching_resource().do_deallocate(
+      thrust::raw_pointer_cast(p), n * sizeof(T), temporary_buffer_alignment<T>());
+  }
+} // end return_temporary_buffer()
+
+} // namespace detail
+} // namespace cpp
+} // namespace system
+THRUST_NAMESPACE_END
+
+#endif // THRUST_CACHE_HOST_TEMPORARY_ALLOCATIONS
@@ -0,0 +1,182 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace batched_search_detail
+{
+
+// XXX this value is a tuning opportunity
+// the number of needles whose searches are interleaved
+const static int batch_size = 32;
+
+template <typename Iterator>
+inline void prefetch(Iterator)
+{}
+
+template <typename T>
+inline void prefetch(T* ptr)
+{
+#if defined(_CCCL_COMPILER_GCC) || defined(_CCCL_COMPILER_CLANG)
+  __builtin_prefetch(ptr);
+#else
+  (void) ptr;
+#endif
+}
+
+} // namespace batched_search_detail
+
+// The three vector searches differ only in the predicate which moves a
+// search to the upper half of its range, and in what is written out once
+// the search position is known.
+struct lower_bound_search
+{
+  template <typename Element, typename T, typename StrictWeakOrdering>
+  static bool go_right(const Element& element, const T& value, StrictWeakOrdering& comp)
+  {
+    return comp(element, value);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+  static Size result(RandomAccessIterator, Size, Size position, const T&, StrictWeakOrdering&)
+  {
+    return position;
+  }
+};
+
+struct upper_bound_search
+{
+  template <typename Element, typename T, typename StrictWeakOrdering>
+  static bool go_right(const Element& element, const T& value, StrictWeakOrdering& comp)
+  {
+    return !comp(value, element);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+  static Size result(RandomAccessIterator, Size, Size position, const T&, StrictWeakOrdering&)
+  {
+    return position;
+  }
+};
+
+struct binary_search_search
+{
+  template <typename Element, typename T, typename StrictWeakOrdering>
+  static bool go_right(const Element& element, const T& value, StrictWeakOrdering& comp)
+  {
+    return comp(element, value);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+  static bool result(RandomAccessIterator first, Size n, Size position, const T& value, StrictWeakOrdering& comp)
+  {
+    return position != n && !comp(value, first[position]);
+  }
+};
+
+// Searches [first, first + n) for each of the num_values needles starting at
+// values and writes the results to output, in the order of the needles.
+//
+// Needles are processed in batches whose branchless searches advance in
+// lock step: the probes of a batch are independent loads which the CPU can
+// keep in flight together, and the probe of the next step, which is known as
+// soon as a search has moved, is prefetched when the haystack is contiguous.
+template <typename Search,
+          typename RandomAccessIterator1,
+          typename Size,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename StrictWeakOrdering>
+void batched_search(RandomAccessIterator1 first,
+                    Size n,
+                    RandomAccessIterator2 values,
+                    Size num_values,
+                    RandomAccessIterator3 output,
+                    StrictWeakOrdering comp)
+{
+  using batched_search_detail::batch_size;
+
+  auto haystack = thrust::try_unwrap_contiguous_iterator(first);
+  auto needles  = thrust::try_unwrap_contiguous_iterator(values);
+
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
+
+  for (Size batch_begin = 0; batch_begin < num_values; batch_begin += batch_size)
+  {
+    const int count = static_cast<int>(num_values - batch_begin < batch_size ? num_values - batch_begin : batch_size);
+
+    Size position[batch_size];
+
+    for (int j = 0; j < count; ++j)
+    {
+      position[j] = 0;
+    }
+
+    // invariant: the result of every search lies in [position, position + size]
+    Size size = n;
+
+    while (size > 1)
+    {
+      const Size half = size / 2;
+
+      size -= half;
+
+      for (int j = 0; j < count; ++j)
+      {
+        const bool right = Search::go_right(haystack[position[j] + half], needles[batch_begin + j], wrapped_comp);
+
+        position[j] += right ? half : 0;
+
+        batched_search_detail::prefetch(haystack + (position[j] + size / 2));
+      }
+    }
+
+    for (int j = 0; j < count; ++j)
+    {
+      if (n > 0 && Search::go_right(haystack[position[j]], needles[batch_begin + j], wrapped_comp))
+      {
+        ++position[j];
+      }
+
+      output[batch_begin + j] = Search::result(haystack, n, position[j], needles[batch_begin + j], wrapped_comp);
+    }
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/binary_search.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Returns the number of elements of [first1, first1 + n1) which precede the
+// diag-th element of the stable merge of [first1, first1 + n1) and
+// [first2, first2 + n2). Elements of the first range are ordered before
+// equivalent elements of the second range.
+//
+// Splitting both ranges at merge_path(diag) and merge_path(diag + k) yields
+// the two subranges which merge into output positions [diag, diag + k), so
+// the merge may be divided into independent pieces of equal output size.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+Size merge_path(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  Size diag,
+  StrictWeakOrdering comp)
+{
+  using value_type1 = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using value_type2 = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  Size begin = (diag > n2) ? diag - n2 : Size(0);
+  Size end   = (diag < n1) ? diag : n1;
+
+  while (begin < end)
+  {
+    Size mid = begin + (end - begin) / 2;
+
+    value_type1 x = first1[mid];
+    value_type2 y = first2[diag - 1 - mid];
+
+    if (comp(y, x))
+    {
+      end = mid;
+    }
+    else
+    {
+      begin = mid + 1;
+    }
+  }
+
+  return begin;
+}
+
+// Like merge_path, but returns the split of both ranges for diag after moving
+// it back to the start of the run of equivalent elements it falls into. All
+// elements before the split compare less than all elements after it, so set
+// operations, which pair up equivalent elements of both ranges, may process
+// the pieces independently of each other.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+thrust::pair<Size, Size> set_operation_path(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  Size diag,
+  StrictWeakOrdering comp)
+{
+  Size i = merge_path(first1, n1, first2, n2, diag, comp);
+  Size j = diag - i;
+
+  // the next element of the merge is first1[i] or first2[j]; everything
+  // preceding it which is equivalent to it moves after the split
+  if (i < n1 && (j == n2 || !comp(first2[j], first1[i])))
+  {
+    typename thrust::iterator_value<RandomAccessIterator1>::type pivot = first1[i];
+
+    i = thrust::lower_bound(thrust::seq, first1, first1 + i, pivot, comp) - first1;
+    j = thrust::lower_bound(thrust::seq, first2, first2 + j, pivot, comp) - first2;
+  }
+  else if (j < n2)
+  {
+    typename thrust::iterator_value<RandomAccessIterator2>::type pivot = first2[j];
+
+    i = thrust::lower_bound(thrust::seq, first1, first1 + i, pivot, comp) - first1;
+    j = thrust::lower_bound(thrust::seq, first2, first2 + j, pivot, comp) - first2;
+  }
+
+  return thrust::make_pair(i, j);
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,277 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/radix_decomposer.h>
+#include <thrust/functional.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+#include <cuda/std/tuple>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The key encoding of the sequential radix sort maps every supported key type
+// onto an unsigned integer with the same ordering.
+template <typename KeyType>
+using radix_encoded_t = decltype(::cuda::std::declval<sequential::radix_sort_detail::RadixEncoder<KeyType>>()(
+  ::cuda::std::declval<KeyType>()));
+
+// Compare orders keys by the fields a decomposer exposes, which are radix sorted
+// instead of the keys.
+template <typename Compare>
+struct is_radix_decomposer : ::cuda::std::false_type
+{};
+
+template <typename Decomposer>
+struct is_radix_decomposer<thrust::decomposer_less<Decomposer>> : ::cuda::std::true_type
+{};
+
+template <typename Decomposer>
+struct is_radix_decomposer<thrust::decomposer_greater<Decomposer>> : ::cuda::std::true_type
+{};
+
+// Parallel radix sort is used for arithmetic keys which the encoder maps onto
+// an unsigned integer (bool is left to the generic path) when they are compared
+// with less or greater, and for keys compared by a decomposer.
+template <typename KeyType, typename Compare>
+struct use_parallel_radix_sort
+    : ::cuda::std::disjunction<
+        ::cuda::std::_And<::cuda::std::is_arithmetic<KeyType>,
+                          ::cuda::std::negation<::cuda::std::is_same<KeyType, bool>>,
+                          ::cuda::std::is_unsigned<radix_encoded_t<KeyType>>,
+                          ::cuda::std::disjunction<::cuda::std::is_same<Compare, thrust::less<KeyType>>,
+                                                   ::cuda::std::is_same<Compare, thrust::greater<KeyType>>>>,
+        is_radix_decomposer<Compare>>
+{};
+
+// sort and sort_by_key leave arithmetic keys compared with less or greater, and
+// keys compared by a decomposer, to stable_sort, which radix sorts most of them.
+// That is faster than a comparison sort, and orders equal keys the same way on
+// every system.
+template <typename KeyType, typename Compare>
+struct use_stable_sort
+    : ::cuda::std::disjunction<
+        ::cuda::std::_And<::cuda::std::is_arithmetic<KeyType>,
+                          ::cuda::std::disjunction<::cuda::std::is_same<Compare, thrust::less<KeyType>>,
+                                                   ::cuda::std::is_same<Compare, thrust::greater<KeyType>>>>,
+        is_radix_decomposer<Compare>>
+{};
+
+// Extracts one 8-bit digit of a key. Sorting by greater inverts the encoded key,
+// so a descending sort is a plain LSD radix sort and remains stable.
+template <typename KeyType, typename Compare>
+struct radix_digit
+{
+  using encoded_type = radix_encoded_t<KeyType>;
+
+  static const unsigned int radix_bits  = 8;
+  static const unsigned int num_buckets = 1u << radix_bits;
+
+  // one pass per byte of the key
+  static const unsigned int num_passes = sizeof(KeyType);
+
+  static const bool descending = ::cuda::std::is_same<Compare, thrust::greater<KeyType>>::value;
+
+  unsigned int shift;
+
+  radix_digit(unsigned int pass, const Compare&)
+      : shift(pass * radix_bits)
+  {}
+
+  std::size_t operator()(const KeyType& key) const
+  {
+    encoded_type x = sequential::radix_sort_detail::RadixEncoder<KeyType>()(key);
+
+    if (descending)
+    {
+      x = ~x;
+    }
+
+    return static_cast<std::size_t>((x >> shift) & static_cast<encoded_type>(num_buckets - 1));
+  }
+};
+
+// the total size of the fields of a decomposed key
+template <typename Tuple, std::size_t Index = ::cuda::std::tuple_size<Tuple>::value>
+struct decomposed_size
+    : ::cuda::std::integral_constant<
+        std::size_t,
+        sizeof(::cuda::std::remove_reference_t<::cuda::std::tuple_element_t<Index - 1, Tuple>>)
+          + decomposed_size<Tuple, Index - 1>::value>
+{};
+
+template <typename Tuple>
+struct decomposed_size<Tuple, 0> : ::cuda::std::integral_constant<std::size_t, 0>
+{};
+
+// Returns one byte of an encoded field of a decomposed key.
+template <typename Field>
+std::size_t decomposed_field_digit(const Field& field, unsigned int byte, bool descending)
+{
+  static_assert(::cuda::std::is_arithmetic<Field>::value && !::cuda::std::is_same<Field, bool>::value
+                  && sizeof(Field) <= 8,
+                "the fields of a decomposed key must be arithmetic types of at most 8 bytes other than bool");
+
+  using encoded_type = radix_encoded_t<Field>;
+
+  encoded_type x = sequential::radix_sort_detail::RadixEncoder<Field>()(field);
+
+  if (descending)
+  {
+    x = static_cast<encoded_type>(~x);
+  }
+
+  return static_cast<std::size_t>((x >> (8 * byte)) & static_cast<encoded_type>(0xff));
+}
+
+// Returns the given byte of field Index of a decomposed key, or of the fields before
+// it once byte is past field Index. The last field is the least significant.
+template <std::size_t Index>
+struct decomposed_digit
+{
+  template <typename Tuple>
+  static std::size_t apply(const Tuple& fields, unsigned int byte, bool descending)
+  {
+    using field_type =
+      ::cuda::std::remove_cv_t<::cuda::std::remove_reference_t<::cuda::std::tuple_element_t<Index, Tuple>>>;
+
+    if (byte < sizeof(field_type))
+    {
+      return decomposed_field_digit(::cuda::std::get<Index>(fields), byte, descending);
+    }
+
+    return decomposed_digit<Index - 1>::apply(fields, byte - sizeof(field_type), descending);
+  }
+};
+
+template <>
+struct decomposed_digit<0>
+{
+  template <typename Tuple>
+  static std::size_t apply(const Tuple& fields, unsigned int byte, bool descending)
+  {
+    return decomposed_field_digit(::cuda::std::get<0>(fields), byte, descending);
+  }
+};
+
+// Extracts one 8-bit digit of the fields a decomposer exposes, as if they were
+// concatenated into a single key, the first field being the most significant.
+template <typename KeyType, typename Decomposer, bool Descending>
+struct decomposed_radix_digit
+{
+  using tuple_type =
+    ::cuda::std::remove_cv_t<::cuda::std::remove_reference_t<thrust::detail::decomposed_t<Decomposer, KeyType>>>;
+
+  static const unsigned int radix_bits  = 8;
+  static const unsigned int num_buckets = 1u << radix_bits;
+
+  // one pass per byte of the fields
+  static const unsigned int num_passes = static_cast<unsigned int>(decomposed_size<tuple_type>::value);
+
+  static const bool descending = Descending;
+
+  Decomposer decomposer;
+  unsigned int byte;
+
+  decomposed_radix_digit(unsigned int pass, const Decomposer& decomposer)
+      : decomposer(decomposer)
+      , byte(pass)
+  {}
+
+  std::size_t operator()(const KeyType& key) const
+  {
+    // the decomposer takes the key by reference, but only reads it
+    return decomposed_digit<::cuda::std::tuple_size<tuple_type>::value - 1>::apply(
+      decomposer(const_cast<KeyType&>(key)), byte, descending);
+  }
+};
+
+template <typename KeyType, typename Decomposer>
+struct radix_digit<KeyType, thrust::decomposer_less<Decomposer>>
+    : decomposed_radix_digit<KeyType, Decomposer, false>
+{
+  radix_digit(unsigned int pass, const thrust::decomposer_less<Decomposer>& comp)
+      : decomposed_radix_digit<KeyType, Decomposer, false>(pass, comp.decomposer)
+  {}
+};
+
+template <typename KeyType, typename Decomposer>
+struct radix_digit<KeyType, thrust::decomposer_greater<Decomposer>>
+    : decomposed_radix_digit<KeyType, Decomposer, true>
+{
+  radix_digit(unsigned int pass, const thrust::decomposer_greater<Decomposer>& comp)
+      : decomposed_radix_digit<KeyType, Decomposer, true>(pass, comp.decomposer)
+  {}
+};
+
+// Turns the per-tile digit counts of one radix pass, stored as num_tiles
+// consecutive histograms of num_buckets entries, into the position at which
+// each tile writes its first key of each digit. Digits are ordered before
+// tiles, so scattering the tiles in any order yields a stable pass.
+//
+// Returns false when all n keys share the same digit, in which case the pass
+// does not move any key and may be skipped.
+template <unsigned int NumBuckets, typename Size>
+bool radix_scan_histograms(std::size_t* histograms, Size num_tiles, std::size_t n)
+{
+  std::size_t sum = 0;
+
+  for (unsigned int d = 0; d < NumBuckets; ++d)
+  {
+    const std::size_t digit_begin = sum;
+
+    for (Size t = 0; t < num_tiles; ++t)
+    {
+      const std::size_t count = histograms[t * NumBuckets + d];
+
+      histograms[t * NumBuckets + d] = sum;
+
+      sum += count;
+    }
+
+    if (sum - digit_begin == n)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
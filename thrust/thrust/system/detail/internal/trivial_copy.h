@@ -0,0 +1,87 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace trivial_copy_detail
+{
+
+// XXX these values are a tuning opportunity
+// below this many bytes a single memmove is faster than waking up the other threads
+const static std::size_t parallel_threshold = std::size_t(1) << 20;
+// the number of bytes copied by each memcpy of a parallel copy
+const static std::size_t chunk_size = std::size_t(1) << 18;
+
+} // namespace trivial_copy_detail
+
+// The parallel trivial copies of the host systems split [first, first + n) into chunks of chunk_size bytes, each
+// copied by one memcpy. That is only correct for ranges which do not overlap, and not worth it for small ones.
+template <typename T>
+bool use_parallel_trivial_copy(const T* first, std::ptrdiff_t n, const T* result)
+{
+  const std::size_t bytes = static_cast<std::size_t>(n) * sizeof(T);
+
+  if (bytes < trivial_copy_detail::parallel_threshold)
+  {
+    return false;
+  }
+
+  const std::uintptr_t src = reinterpret_cast<std::uintptr_t>(first);
+  const std::uintptr_t dst = reinterpret_cast<std::uintptr_t>(result);
+
+  return src + bytes <= dst || dst + bytes <= src;
+}
+
+inline std::size_t trivial_copy_num_chunks(std::size_t bytes)
+{
+  return (bytes + trivial_copy_detail::chunk_size - 1) / trivial_copy_detail::chunk_size;
+}
+
+// copies the chunk-th chunk of bytes bytes from src to dst
+inline void trivial_copy_chunk(const void* src, void* dst, std::size_t bytes, std::size_t chunk)
+{
+  const std::size_t offset    = chunk * trivial_copy_detail::chunk_size;
+  const std::size_t remaining = bytes - offset;
+  const std::size_t size =
+    remaining < trivial_copy_detail::chunk_size ? remaining : trivial_copy_detail::chunk_size;
+
+  std::memcpy(static_cast<char*>(dst) + offset, static_cast<const char*>(src) + offset, size);
+}
+
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
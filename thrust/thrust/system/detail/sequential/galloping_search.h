@@ -0,0 +1,131 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file galloping_search.h
+ *  \brief Exponential searches used by the sequential merge and set operations.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/binary_search.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+// Merges and set operations switch from stepping through their inputs one
+// element at a time to galloping over the input which has produced this many
+// elements in a row. Interleaved inputs rarely get there, while each run of a
+// much longer input costs O(log(run)) comparisons instead of O(run).
+static const int galloping_threshold = 8;
+
+// galloping needs to jump ahead in all of the inputs
+template <typename... Iterators>
+struct use_galloping
+    : ::cuda::std::conjunction<
+        ::cuda::std::is_convertible<typename thrust::iterator_traversal<Iterators>::type,
+                                    thrust::random_access_traversal_tag>...>
+{};
+
+// Returns the first element of [first, last) which is not less than val. The
+// probes double in distance from first, so the cost is logarithmic in the
+// distance to the result rather than in the length of the range.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator gallop_lower_bound(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  const T& val,
+  StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
+
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  difference_type len = last - first;
+
+  // [first, first + lo) is less than val
+  difference_type lo   = 0;
+  difference_type step = 1;
+
+  while (step <= len - lo && wrapped_comp(first[lo + step - 1], val))
+  {
+    lo += step;
+    step *= 2;
+  }
+
+  difference_type hi = (step - 1 < len - lo) ? lo + step - 1 : len;
+
+  return sequential::lower_bound(exec, first + lo, first + hi, val, comp);
+}
+
+// Returns the first element of [first, last) which is greater than val, as
+// gallop_lower_bound does.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator gallop_upper_bound(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  const T& val,
+  StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
+
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  difference_type len = last - first;
+
+  // [first, first + lo) is not greater than val
+  difference_type lo   = 0;
+  difference_type step = 1;
+
+  while (step <= len - lo && !wrapped_comp(val, first[lo + step - 1]))
+  {
+    lo += step;
+    step *= 2;
+  }
+
+  difference_type hi = (step - 1 < len - lo) ? lo + step - 1 : len;
+
+  return sequential::upper_bound(exec, first + lo, first + hi, val, comp);
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -27,9 +27,14 @@
 #endif // no system header
 #include <thrust/detail/copy.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/sequential/galloping_search.h>
 #include <thrust/system/detail/sequential/merge.h>
 
+#include <cuda/std/type_traits>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -38,6 +43,68 @@ namespace detail
 namespace sequential
 {
 
+namespace merge_detail
+{
+
+// Moves the lesser of *first1 and *first2 to *result, *first1 if they are
+// equivalent.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void merge_step(
+  RandomAccessIterator1& first1,
+  RandomAccessIterator2& first2,
+  OutputIterator result,
+  StrictWeakOrdering& comp,
+  thrust::detail::false_type)
+{
+  if (comp(*first2, *first1))
+  {
+    *result = *first2;
+    ++first2;
+  } // end if
+  else
+  {
+    *result = *first1;
+    ++first1;
+  } // end else
+} // end merge_step()
+
+// The outcome of each comparison is unpredictable when the inputs interleave,
+// so arithmetic values are selected and the inputs advanced without branching.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void merge_step(
+  RandomAccessIterator1& first1,
+  RandomAccessIterator2& first2,
+  OutputIterator result,
+  StrictWeakOrdering& comp,
+  thrust::detail::true_type)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  const value_type value1 = *first1;
+  const value_type value2 = *first2;
+
+  const bool take2 = comp(value2, value1);
+
+  *result = take2 ? value2 : value1;
+  first1 += !take2;
+  first2 += take2;
+} // end merge_step()
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+struct use_branchless_merge_step
+    : ::cuda::std::_And<::cuda::std::is_arithmetic<typename thrust::iterator_value<RandomAccessIterator1>::type>,
+                        ::cuda::std::is_same<typename thrust::iterator_value<RandomAccessIterator1>::type,
+                                             typename thrust::iterator_value<RandomAccessIterator2>::type>>
+{};
+
 _CCCL_EXEC_CHECK_DISABLE
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -51,7 +118,8 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   InputIterator2 first2,
   InputIterator2 last2,
   OutputIterator result,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
@@ -75,6 +143,66 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   return thrust::copy(exec, first2, last2, thrust::copy(exec, first1, last1, result));
 } // end merge()
 
+// Merges two random access inputs. They are merged in blocks of
+// galloping_threshold elements, and once a whole block comes from one of the
+// inputs, the rest of that run is galloped over.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator merge(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  RandomAccessIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
+
+  use_branchless_merge_step<RandomAccessIterator1, RandomAccessIterator2> use_branchless;
+
+  // neither input can run out within a block
+  while (last1 - first1 >= galloping_threshold && last2 - first2 >= galloping_threshold)
+  {
+    RandomAccessIterator1 block_first1 = first1;
+
+    for (int i = 0; i < galloping_threshold; ++i)
+    {
+      merge_step(first1, first2, result, wrapped_comp, use_branchless);
+      ++result;
+    } // end for
+
+    if (first1 - block_first1 == galloping_threshold)
+    {
+      // the elements of the first input which are not greater than *first2
+      RandomAccessIterator1 mid1 = sequential::gallop_upper_bound(exec, first1, last1, *first2, comp);
+      result                     = thrust::copy(exec, first1, mid1, result);
+      first1                     = mid1;
+    } // end if
+    else if (first1 == block_first1)
+    {
+      // the elements of the second input which are less than *first1
+      RandomAccessIterator2 mid2 = sequential::gallop_lower_bound(exec, first2, last2, *first1, comp);
+      result                     = thrust::copy(exec, first2, mid2, result);
+      first2                     = mid2;
+    } // end else if
+  } // end while
+
+  while (first1 != last1 && first2 != last2)
+  {
+    merge_step(first1, first2, result, wrapped_comp, use_branchless);
+    ++result;
+  } // end while
+
+  return thrust::copy(exec, first2, last2, thrust::copy(exec, first1, last1, result));
+} // end merge()
+
 _CCCL_EXEC_CHECK_DISABLE
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -94,7 +222,8 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   InputIterator4 values_first2,
   OutputIterator1 keys_result,
   OutputIterator2 values_result,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
@@ -145,6 +274,178 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   return thrust::make_pair(keys_result, values_result);
 }
 
+// Moves the lesser of *keys_first1 and *keys_first2, *keys_first1 if they are
+// equivalent, and its value to the results.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void merge_by_key_step(
+  RandomAccessIterator1& keys_first1,
+  RandomAccessIterator2& keys_first2,
+  RandomAccessIterator3& values_first1,
+  RandomAccessIterator4& values_first2,
+  OutputIterator1& keys_result,
+  OutputIterator2& values_result,
+  StrictWeakOrdering& comp)
+{
+  if (!comp(*keys_first2, *keys_first1))
+  {
+    // *keys_first1 <= *keys_first2
+    *keys_result   = *keys_first1;
+    *values_result = *values_first1;
+    ++keys_first1;
+    ++values_first1;
+  }
+  else
+  {
+    // *keys_first1 > keys_first2
+    *keys_result   = *keys_first2;
+    *values_result = *values_first2;
+    ++keys_first2;
+    ++values_first2;
+  }
+
+  ++keys_result;
+  ++values_result;
+} // end merge_by_key_step()
+
+// Merges two random access inputs by key in blocks, galloping as merge does.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first1,
+  RandomAccessIterator1 keys_last1,
+  RandomAccessIterator2 keys_first2,
+  RandomAccessIterator2 keys_last2,
+  RandomAccessIterator3 values_first1,
+  RandomAccessIterator4 values_first2,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
+
+  // neither input can run out within a block
+  while (keys_last1 - keys_first1 >= galloping_threshold && keys_last2 - keys_first2 >= galloping_threshold)
+  {
+    RandomAccessIterator1 block_first1 = keys_first1;
+
+    for (int i = 0; i < galloping_threshold; ++i)
+    {
+      merge_by_key_step(
+        keys_first1, keys_first2, values_first1, values_first2, keys_result, values_result, wrapped_comp);
+    } // end for
+
+    if (keys_first1 - block_first1 == galloping_threshold)
+    {
+      // the keys of the first input which are not greater than *keys_first2
+      RandomAccessIterator1 keys_mid1 =
+        sequential::gallop_upper_bound(exec, keys_first1, keys_last1, *keys_first2, comp);
+
+      values_result = thrust::copy_n(exec, values_first1, keys_mid1 - keys_first1, values_result);
+      values_first1 += keys_mid1 - keys_first1;
+      keys_result = thrust::copy(exec, keys_first1, keys_mid1, keys_result);
+      keys_first1 = keys_mid1;
+    } // end if
+    else if (keys_first1 == block_first1)
+    {
+      // the keys of the second input which are less than *keys_first1
+      RandomAccessIterator2 keys_mid2 =
+        sequential::gallop_lower_bound(exec, keys_first2, keys_last2, *keys_first1, comp);
+
+      values_result = thrust::copy_n(exec, values_first2, keys_mid2 - keys_first2, values_result);
+      values_first2 += keys_mid2 - keys_first2;
+      keys_result = thrust::copy(exec, keys_first2, keys_mid2, keys_result);
+      keys_first2 = keys_mid2;
+    } // end else if
+  } // end while
+
+  while (keys_first1 != keys_last1 && keys_first2 != keys_last2)
+  {
+    merge_by_key_step(keys_first1, keys_first2, values_first1, values_first2, keys_result, values_result, wrapped_comp);
+  } // end while
+
+  values_result = thrust::copy_n(exec, values_first1, keys_last1 - keys_first1, values_result);
+  values_result = thrust::copy_n(exec, values_first2, keys_last2 - keys_first2, values_result);
+  keys_result   = thrust::copy(exec, keys_first2, keys_last2, thrust::copy(exec, keys_first1, keys_last1, keys_result));
+
+  return thrust::make_pair(keys_result, values_result);
+} // end merge_by_key()
+
+} // end namespace merge_detail
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator merge(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  use_galloping<InputIterator1, InputIterator2> gallop;
+
+  return merge_detail::merge(exec, first1, last1, first2, last2, result, comp, gallop);
+} // end merge()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first1,
+  InputIterator1 keys_last1,
+  InputIterator2 keys_first2,
+  InputIterator2 keys_last2,
+  InputIterator3 values_first1,
+  InputIterator4 values_first2,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  use_galloping<InputIterator1, InputIterator2, InputIterator3, InputIterator4> gallop;
+
+  return merge_detail::merge_by_key(
+    exec,
+    keys_first1,
+    keys_last1,
+    keys_first2,
+    keys_last2,
+    values_first1,
+    values_first2,
+    keys_result,
+    values_result,
+    comp,
+    gallop);
+} // end merge_by_key()
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
@@ -0,0 +1,666 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file pdqsort.h
+ *  \brief An unstable, in-place pattern-defeating quicksort.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+#include <cuda/std/utility>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace pdqsort_detail
+{
+
+// XXX these values are a tuning opportunity
+// ranges smaller than this are insertion sorted
+const static std::ptrdiff_t insertion_sort_threshold = 24;
+// ranges larger than this take their pivot as the median of three medians of three
+const static std::ptrdiff_t ninther_threshold = 128;
+// the number of elements partial_insertion_sort may move before it gives up
+const static std::ptrdiff_t partial_insertion_sort_limit = 8;
+// the number of elements classified at once by the branchless partition
+const static std::ptrdiff_t block_size = 64;
+
+// Moving elements around blocks of comparison results pays off when elements are cheap to move. Otherwise the
+// partition compares and swaps one pair at a time.
+template <typename T>
+struct use_branchless_partition : thrust::is_trivially_relocatable<T>
+{};
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void iter_swap(RandomAccessIterator a, RandomAccessIterator b)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  value_type tmp = ::cuda::std::move(*a);
+  *a             = ::cuda::std::move(*b);
+  *b             = ::cuda::std::move(tmp);
+}
+
+inline _CCCL_HOST_DEVICE int log2(std::ptrdiff_t n)
+{
+  int result = 0;
+  while (n >>= 1)
+  {
+    ++result;
+  }
+  return result;
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+insertion_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  if (first == last)
+  {
+    return;
+  }
+
+  for (RandomAccessIterator i = first + 1; i != last; ++i)
+  {
+    if (comp(*i, *(i - 1)))
+    {
+      value_type tmp         = ::cuda::std::move(*i);
+      RandomAccessIterator j = i;
+
+      do
+      {
+        *j = ::cuda::std::move(*(j - 1));
+        --j;
+      } while (j != first && comp(tmp, *(j - 1)));
+
+      *j = ::cuda::std::move(tmp);
+    }
+  }
+}
+
+// insertion sort of a range which is preceded by an element not greater than any of its own, so that the inner
+// loop need not check for the beginning of the range
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+unguarded_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  if (first == last)
+  {
+    return;
+  }
+
+  for (RandomAccessIterator i = first + 1; i != last; ++i)
+  {
+    if (comp(*i, *(i - 1)))
+    {
+      value_type tmp         = ::cuda::std::move(*i);
+      RandomAccessIterator j = i;
+
+      do
+      {
+        *j = ::cuda::std::move(*(j - 1));
+        --j;
+      } while (comp(tmp, *(j - 1)));
+
+      *j = ::cuda::std::move(tmp);
+    }
+  }
+}
+
+// insertion sorts [first, last) unless that takes more than partial_insertion_sort_limit moves. returns whether
+// the range was sorted
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE bool
+partial_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  if (first == last)
+  {
+    return true;
+  }
+
+  std::ptrdiff_t moves = 0;
+
+  for (RandomAccessIterator i = first + 1; i != last; ++i)
+  {
+    if (comp(*i, *(i - 1)))
+    {
+      value_type tmp         = ::cuda::std::move(*i);
+      RandomAccessIterator j = i;
+
+      do
+      {
+        *j = ::cuda::std::move(*(j - 1));
+        --j;
+      } while (j != first && comp(tmp, *(j - 1)));
+
+      *j = ::cuda::std::move(tmp);
+      moves += i - j;
+
+      if (moves > partial_insertion_sort_limit)
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+sift_down(RandomAccessIterator first, std::ptrdiff_t n, std::ptrdiff_t i, StrictWeakOrdering& comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  value_type value = ::cuda::std::move(first[i]);
+
+  for (std::ptrdiff_t child = 2 * i + 1; child < n; child = 2 * i + 1)
+  {
+    if (child + 1 < n && comp(first[child], first[child + 1]))
+    {
+      ++child;
+    }
+
+    if (!comp(value, first[child]))
+    {
+      break;
+    }
+
+    first[i] = ::cuda::std::move(first[child]);
+    i        = child;
+  }
+
+  first[i] = ::cuda::std::move(value);
+}
+
+// the fallback which bounds the running time when too many partitions are unbalanced
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void heap_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  const std::ptrdiff_t n = last - first;
+
+  for (std::ptrdiff_t i = n / 2; i-- > 0;)
+  {
+    pdqsort_detail::sift_down(first, n, i, comp);
+  }
+
+  for (std::ptrdiff_t end = n - 1; end > 0; --end)
+  {
+    pdqsort_detail::iter_swap(first, first + end);
+    pdqsort_detail::sift_down(first, end, 0, comp);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sort2(RandomAccessIterator a, RandomAccessIterator b, StrictWeakOrdering& comp)
+{
+  if (comp(*b, *a))
+  {
+    pdqsort_detail::iter_swap(a, b);
+  }
+}
+
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+sort3(RandomAccessIterator a, RandomAccessIterator b, RandomAccessIterator c, StrictWeakOrdering& comp)
+{
+  pdqsort_detail::sort2(a, b, comp);
+  pdqsort_detail::sort2(b, c, comp);
+  pdqsort_detail::sort2(a, b, comp);
+}
+
+// Partitions [first, last) around the pivot *first: the elements less than the pivot come before it and the others
+// after it. Returns the position of the pivot, and whether the range was already partitioned. Requires an element
+// not less than the pivot to follow it in the range, which the median selection guarantees.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<RandomAccessIterator, bool>
+partition_right(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  value_type pivot = ::cuda::std::move(*first);
+
+  RandomAccessIterator l = first;
+  RandomAccessIterator r = last;
+
+  // find the first element not less than the pivot, and the last one less than it
+  while (comp(*++l, pivot))
+  {}
+
+  if (l - 1 == first)
+  {
+    while (l < r && !comp(*--r, pivot))
+    {}
+  }
+  else
+  {
+    while (!comp(*--r, pivot))
+    {}
+  }
+
+  const bool already_partitioned = l >= r;
+
+  while (l < r)
+  {
+    pdqsort_detail::iter_swap(l, r);
+
+    while (comp(*++l, pivot))
+    {}
+    while (!comp(*--r, pivot))
+    {}
+  }
+
+  RandomAccessIterator pivot_pos = l - 1;
+  *first                         = ::cuda::std::move(*pivot_pos);
+  *pivot_pos                     = ::cuda::std::move(pivot);
+
+  return thrust::make_pair(pivot_pos, already_partitioned);
+}
+
+// swaps the elements at l_base + l_offsets[i] with those at r_base - r_offsets[i]. unless both sides have the same
+// number of misplaced elements, the swaps are done as a single cycle of moves
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void swap_offsets(
+  RandomAccessIterator l_base,
+  RandomAccessIterator r_base,
+  const unsigned char* l_offsets,
+  const unsigned char* r_offsets,
+  std::ptrdiff_t num,
+  bool use_swaps)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  if (use_swaps)
+  {
+    for (std::ptrdiff_t i = 0; i < num; ++i)
+    {
+      pdqsort_detail::iter_swap(l_base + l_offsets[i], r_base - r_offsets[i]);
+    }
+  }
+  else if (num > 0)
+  {
+    RandomAccessIterator l = l_base + l_offsets[0];
+    RandomAccessIterator r = r_base - r_offsets[0];
+    value_type tmp         = ::cuda::std::move(*l);
+    *l                     = ::cuda::std::move(*r);
+
+    for (std::ptrdiff_t i = 1; i < num; ++i)
+    {
+      l  = l_base + l_offsets[i];
+      *r = ::cuda::std::move(*l);
+      r  = r_base - r_offsets[i];
+      *l = ::cuda::std::move(*r);
+    }
+
+    *r = ::cuda::std::move(tmp);
+  }
+}
+
+// Like partition_right, but the comparisons of a block of elements are made first and their results only stored,
+// as in "BlockQuicksort: How Branch Mispredictions don't affect Quicksort" (Edelkamp and Weiss), so that the
+// outcome of a comparison is never branched on.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<RandomAccessIterator, bool>
+partition_right_branchless(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  value_type pivot = ::cuda::std::move(*first);
+
+  RandomAccessIterator l = first;
+  RandomAccessIterator r = last;
+
+  while (comp(*++l, pivot))
+  {}
+
+  if (l - 1 == first)
+  {
+    while (l < r && !comp(*--r, pivot))
+    {}
+  }
+  else
+  {
+    while (!comp(*--r, pivot))
+    {}
+  }
+
+  const bool already_partitioned = l >= r;
+
+  if (!already_partitioned)
+  {
+    pdqsort_detail::iter_swap(l, r);
+    ++l;
+
+    // the offsets of the elements on the wrong side, from l_base forwards and from r_base backwards
+    unsigned char l_offsets[block_size];
+    unsigned char r_offsets[block_size];
+
+    RandomAccessIterator l_base = l;
+    RandomAccessIterator r_base = r;
+
+    std::ptrdiff_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+    while (l < r)
+    {
+      // refill the blocks which have been used up, splitting the unclassified elements between them
+      const std::ptrdiff_t num_unknown = r - l;
+      const std::ptrdiff_t l_split     = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+      const std::ptrdiff_t r_split     = num_r == 0 ? (num_unknown - l_split) : 0;
+
+      const std::ptrdiff_t l_count = l_split < block_size ? l_split : block_size;
+      for (std::ptrdiff_t i = 0; i < l_count; ++i)
+      {
+        l_offsets[num_l] = static_cast<unsigned char>(i);
+        num_l += !comp(*l, pivot);
+        ++l;
+      }
+
+      const std::ptrdiff_t r_count = r_split < block_size ? r_split : block_size;
+      for (std::ptrdiff_t i = 0; i < r_count;)
+      {
+        r_offsets[num_r] = static_cast<unsigned char>(++i);
+        num_r += comp(*--r, pivot);
+      }
+
+      // swap as many misplaced pairs as both blocks have
+      const std::ptrdiff_t num = num_l < num_r ? num_l : num_r;
+      pdqsort_detail::swap_offsets(l_base, r_base, l_offsets + start_l, r_offsets + start_r, num, num_l == num_r);
+
+      num_l -= num;
+      num_r -= num;
+      start_l += num;
+      start_r += num;
+
+      if (num_l == 0)
+      {
+        start_l = 0;
+        l_base  = l;
+      }
+
+      if (num_r == 0)
+      {
+        start_r = 0;
+        r_base  = r;
+      }
+    }
+
+    // all elements are classified; move the misplaced ones left in a block to the boundary
+    if (num_l)
+    {
+      while (num_l--)
+      {
+        pdqsort_detail::iter_swap(l_base + l_offsets[start_l + num_l], --r);
+      }
+      l = r;
+    }
+
+    if (num_r)
+    {
+      while (num_r--)
+      {
+        pdqsort_detail::iter_swap(r_base - r_offsets[start_r + num_r], l);
+        ++l;
+      }
+      r = l;
+    }
+  }
+
+  RandomAccessIterator pivot_pos = l - 1;
+  *first                         = ::cuda::std::move(*pivot_pos);
+  *pivot_pos                     = ::cuda::std::move(pivot);
+
+  return thrust::make_pair(pivot_pos, already_partitioned);
+}
+
+// Partitions [first, last) around the pivot *first so that the elements equivalent to the pivot come before it and
+// the greater ones after it. Used when the element before the range is equivalent to the pivot, so that runs of
+// equal elements are dealt with in linear time.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator
+partition_left(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  value_type pivot = ::cuda::std::move(*first);
+
+  RandomAccessIterator l = first;
+  RandomAccessIterator r = last;
+
+  while (comp(pivot, *--r))
+  {}
+
+  if (r + 1 == last)
+  {
+    while (l < r && !comp(pivot, *++l))
+    {}
+  }
+  else
+  {
+    while (!comp(pivot, *++l))
+    {}
+  }
+
+  while (l < r)
+  {
+    pdqsort_detail::iter_swap(l, r);
+
+    while (comp(pivot, *--r))
+    {}
+    while (!comp(pivot, *++l))
+    {}
+  }
+
+  *first = ::cuda::std::move(*r);
+  *r     = ::cuda::std::move(pivot);
+
+  return r;
+}
+
+// The pdqsort loop of Orson Peters' "Pattern-defeating Quicksort": a quicksort which insertion sorts small ranges,
+// partitions runs of equal elements in linear time, recognizes already sorted partitions, breaks up patterns which
+// lead to unbalanced partitions, and falls back to heap sort when that keeps happening.
+//
+// The range to the left of each pivot is handed to recurse(first, last, bad_allowed, leftmost), which sorts it by
+// calling pdqsort_loop again, and the loop carries on with the range to the right. A parallel system can sort the
+// left range in another thread instead. leftmost is false if the element before first is not greater than any
+// element of [first, last).
+_CCCL_EXEC_CHECK_DISABLE
+template <bool Branchless, typename RandomAccessIterator, typename StrictWeakOrdering, typename Recurse>
+_CCCL_HOST_DEVICE void pdqsort_loop(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  StrictWeakOrdering& comp,
+  int bad_allowed,
+  bool leftmost,
+  Recurse& recurse)
+{
+  while (true)
+  {
+    const std::ptrdiff_t n = last - first;
+
+    if (n < insertion_sort_threshold)
+    {
+      if (leftmost)
+      {
+        pdqsort_detail::insertion_sort(first, last, comp);
+      }
+      else
+      {
+        pdqsort_detail::unguarded_insertion_sort(first, last, comp);
+      }
+      return;
+    }
+
+    // move the pivot to *first
+    const std::ptrdiff_t half = n / 2;
+    if (n > ninther_threshold)
+    {
+      pdqsort_detail::sort3(first, first + half, last - 1, comp);
+      pdqsort_detail::sort3(first + 1, first + (half - 1), last - 2, comp);
+      pdqsort_detail::sort3(first + 2, first + (half + 1), last - 3, comp);
+      pdqsort_detail::sort3(first + (half - 1), first + half, first + (half + 1), comp);
+      pdqsort_detail::iter_swap(first, first + half);
+    }
+    else
+    {
+      pdqsort_detail::sort3(first + half, first, last - 1, comp);
+    }
+
+    // the pivot equals the element before the range, so no element of the range is less than the pivot: put all
+    // elements equivalent to it on the left, where they are done
+    if (!leftmost && !comp(*(first - 1), *first))
+    {
+      first = pdqsort_detail::partition_left(first, last, comp) + 1;
+      continue;
+    }
+
+    thrust::pair<RandomAccessIterator, bool> part = Branchless
+                                                    ? pdqsort_detail::partition_right_branchless(first, last, comp)
+                                                    : pdqsort_detail::partition_right(first, last, comp);
+
+    RandomAccessIterator pivot_pos = part.first;
+
+    const std::ptrdiff_t l_size = pivot_pos - first;
+    const std::ptrdiff_t r_size = last - (pivot_pos + 1);
+
+    if (l_size < n / 8 || r_size < n / 8)
+    {
+      if (--bad_allowed == 0)
+      {
+        pdqsort_detail::heap_sort(first, last, comp);
+        return;
+      }
+
+      // swap a few elements into different places, to break the pattern which led to the unbalanced partition
+      if (l_size >= insertion_sort_threshold)
+      {
+        pdqsort_detail::iter_swap(first, first + l_size / 4);
+        pdqsort_detail::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+
+        if (l_size > ninther_threshold)
+        {
+          pdqsort_detail::iter_swap(first + 1, first + (l_size / 4 + 1));
+          pdqsort_detail::iter_swap(first + 2, first + (l_size / 4 + 2));
+          pdqsort_detail::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+          pdqsort_detail::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+        }
+      }
+
+      if (r_size >= insertion_sort_threshold)
+      {
+        pdqsort_detail::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+        pdqsort_detail::iter_swap(last - 1, last - r_size / 4);
+
+        if (r_size > ninther_threshold)
+        {
+          pdqsort_detail::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+          pdqsort_detail::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+          pdqsort_detail::iter_swap(last - 2, last - (1 + r_size / 4));
+          pdqsort_detail::iter_swap(last - 3, last - (2 + r_size / 4));
+        }
+      }
+    }
+    else if (part.second && pdqsort_detail::partial_insertion_sort(first, pivot_pos, comp)
+             && pdqsort_detail::partial_insertion_sort(pivot_pos + 1, last, comp))
+    {
+      // a balanced partition which moved nothing is a hint that the input is sorted; if insertion sort quickly
+      // confirms that, we are done
+      return;
+    }
+
+    recurse(first, pivot_pos, bad_allowed, leftmost);
+
+    first    = pivot_pos + 1;
+    leftmost = false;
+  }
+}
+
+template <bool Branchless, typename StrictWeakOrdering>
+struct sequential_recurse
+{
+  StrictWeakOrdering& comp;
+
+  template <typename RandomAccessIterator>
+  _CCCL_HOST_DEVICE void
+  operator()(RandomAccessIterator first, RandomAccessIterator last, int bad_allowed, bool leftmost)
+  {
+    pdqsort_detail::pdqsort_loop<Branchless>(first, last, comp, bad_allowed, leftmost, *this);
+  }
+};
+
+} // namespace pdqsort_detail
+
+// sorts [first, last) with comp, without allocating. Branchless selects the block partition
+template <bool Branchless, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void pdqsort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  if (last - first < 2)
+  {
+    return;
+  }
+
+  // wrap comp
+  using wrapped_comp_type = thrust::detail::wrapped_function<StrictWeakOrdering, bool>;
+  wrapped_comp_type wrapped_comp(comp);
+
+  pdqsort_detail::sequential_recurse<Branchless, wrapped_comp_type> recurse{wrapped_comp};
+
+  pdqsort_detail::pdqsort_loop<Branchless>(
+    first, last, wrapped_comp, pdqsort_detail::log2(last - first), true, recurse);
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -30,7 +30,28 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/function.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cuda/std/type_traits>
+
+#include <nv/target>
+
+// Reductions of floating point values on the host systems accumulate into a
+// single value, in the order of the input, unless
+// THRUST_REASSOCIATE_HOST_FLOATING_POINT_REDUCTIONS is defined. Then they are
+// reduced in independent lanes like integers, which lets the compiler
+// vectorize the loop but changes the rounding of sums and products, as well as
+// which NaN minimum and maximum return. It changes the definition of inline
+// functions, so it must be defined in all translation units of a program or in
+// none of them.
+//
+// #define THRUST_REASSOCIATE_HOST_FLOATING_POINT_REDUCTIONS
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -39,15 +60,185 @@ namespace detail
 {
 namespace sequential
 {
+namespace reduce_detail
+{
+
+// iterators which read contiguous memory, possibly through transform and zip
+// iterators, as transform_reduce and inner_product do
+template <typename Iterator>
+struct is_contiguous_source : thrust::is_contiguous_iterator<Iterator>
+{};
+
+template <typename UnaryFunction, typename Iterator, typename Reference, typename Value>
+struct is_contiguous_source<thrust::transform_iterator<UnaryFunction, Iterator, Reference, Value>>
+    : is_contiguous_source<Iterator>
+{};
+
+template <typename... Iterators>
+struct is_contiguous_source<thrust::zip_iterator<thrust::tuple<Iterators...>>>
+    : ::cuda::std::conjunction<is_contiguous_source<Iterators>...>
+{};
+
+template <template <typename> class Operator, typename BinaryFunction, typename T>
+struct is_operator
+    : ::cuda::std::disjunction<::cuda::std::is_same<BinaryFunction, Operator<T>>,
+                               ::cuda::std::is_same<BinaryFunction, Operator<void>>>
+{};
+
+// operators which are associative and commutative on integers
+template <typename BinaryFunction, typename T>
+struct is_reassociable_operator
+    : ::cuda::std::disjunction<is_operator<thrust::plus, BinaryFunction, T>,
+                               is_operator<thrust::multiplies, BinaryFunction, T>,
+                               is_operator<thrust::minimum, BinaryFunction, T>,
+                               is_operator<thrust::maximum, BinaryFunction, T>,
+                               is_operator<thrust::bit_and, BinaryFunction, T>,
+                               is_operator<thrust::bit_or, BinaryFunction, T>,
+                               is_operator<thrust::bit_xor, BinaryFunction, T>>
+{};
+
+template <typename T>
+struct may_reassociate
+#if defined(THRUST_REASSOCIATE_HOST_FLOATING_POINT_REDUCTIONS)
+    : ::cuda::std::true_type
+#else
+    : ::cuda::std::negation<::cuda::std::is_floating_point<T>>
+#endif
+{};
+
+// Reductions of arithmetic values read from contiguous memory with one of the
+// operators above are reduced in lanes. The input must already have the type of
+// the result, so that no conversion happens in a different order.
+template <typename InputIterator, typename OutputType, typename BinaryFunction>
+struct use_reduce_lanes
+    : ::cuda::std::_And<::cuda::std::is_arithmetic<OutputType>,
+                        ::cuda::std::negation<::cuda::std::is_same<OutputType, bool>>,
+                        ::cuda::std::is_same<thrust::iterator_value_t<InputIterator>, OutputType>,
+                        is_contiguous_source<InputIterator>,
+                        is_reassociable_operator<BinaryFunction, OutputType>,
+                        may_reassociate<OutputType>>
+{};
+
+// A lane may overflow where the reduction in order would not, which is undefined
+// for sums and products of signed integers. Those are reduced in the unsigned
+// type of the same width, which wraps around instead, and converted back at the
+// end. The result is the same whenever the reduction in order does not overflow.
+template <typename T, typename BinaryFunction, typename = void>
+struct reduce_lane
+{
+  using type = T;
+
+  _CCCL_HOST_DEVICE static BinaryFunction function(BinaryFunction binary_op)
+  {
+    return binary_op;
+  }
+};
+
+template <typename T, typename BinaryFunction>
+struct reduce_lane<
+  T,
+  BinaryFunction,
+  ::cuda::std::enable_if_t<::cuda::std::is_integral<T>::value && ::cuda::std::is_signed<T>::value
+                           && is_operator<thrust::plus, BinaryFunction, T>::value>>
+{
+  using type = ::cuda::std::make_unsigned_t<T>;
 
+  _CCCL_HOST_DEVICE static thrust::plus<type> function(BinaryFunction)
+  {
+    return thrust::plus<type>();
+  }
+};
+
+template <typename T, typename BinaryFunction>
+struct reduce_lane<
+  T,
+  BinaryFunction,
+  ::cuda::std::enable_if_t<::cuda::std::is_integral<T>::value && ::cuda::std::is_signed<T>::value
+                           && is_operator<thrust::multiplies, BinaryFunction, T>::value>>
+{
+  using type = ::cuda::std::make_unsigned_t<T>;
+
+  _CCCL_HOST_DEVICE static thrust::multiplies<type> function(BinaryFunction)
+  {
+    return thrust::multiplies<type>();
+  }
+};
+
+// a cache line of lanes, but at least 4 and at most 16 of them
+template <typename T>
+struct num_reduce_lanes
+    : ::cuda::std::integral_constant<int, (64 / sizeof(T) < 4) ? 4 : (64 / sizeof(T) > 16) ? 16 : 64 / sizeof(T)>
+{};
+
+// Reduces [first, first + n) into init. Each of the lanes accumulates every
+// num_lanes-th element, so there is no dependency from one element to the next
+// and the loop can be vectorized. The lanes are reduced into init at the end.
 _CCCL_EXEC_CHECK_DISABLE
-template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
-_CCCL_HOST_DEVICE OutputType reduce(
-  sequential::execution_policy<DerivedPolicy>&,
-  InputIterator begin,
-  InputIterator end,
-  OutputType init,
-  BinaryFunction binary_op)
+template <typename RandomAccessIterator, typename Size, typename OutputType, typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputType
+reduce_n_in_lanes(RandomAccessIterator first, Size n, OutputType init, BinaryFunction binary_op)
+{
+  using Lane     = reduce_lane<OutputType, BinaryFunction>;
+  using LaneType = typename Lane::type;
+
+  const int num_lanes = num_reduce_lanes<OutputType>::value;
+
+  // wrap the operator of the lanes
+  auto lane_op = Lane::function(binary_op);
+  thrust::detail::wrapped_function<decltype(lane_op), LaneType> wrapped_binary_op(lane_op);
+
+  LaneType result = static_cast<LaneType>(init);
+
+  Size num_blocks = n / static_cast<Size>(num_lanes);
+
+  if (num_blocks > 0)
+  {
+    LaneType lanes[num_lanes];
+
+    for (int j = 0; j < num_lanes; ++j)
+    {
+      lanes[j] = static_cast<LaneType>(first[j]);
+    }
+
+    first += num_lanes;
+
+    for (Size block = 1; block < num_blocks; ++block)
+    {
+      for (int j = 0; j < num_lanes; ++j)
+      {
+        lanes[j] = wrapped_binary_op(lanes[j], static_cast<LaneType>(first[j]));
+      }
+
+      first += num_lanes;
+    }
+
+    for (int j = 0; j < num_lanes; ++j)
+    {
+      result = wrapped_binary_op(result, lanes[j]);
+    }
+  }
+
+  for (Size i = num_blocks * static_cast<Size>(num_lanes); i < n; ++i)
+  {
+    result = wrapped_binary_op(result, static_cast<LaneType>(*first));
+    ++first;
+  }
+
+  return static_cast<OutputType>(result);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename InputIterator, typename OutputType, typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputType
+reduce(InputIterator begin, InputIterator end, OutputType init, BinaryFunction binary_op, thrust::detail::true_type)
+{
+  return reduce_detail::reduce_n_in_lanes(begin, end - begin, init, binary_op);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename InputIterator, typename OutputType, typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputType
+reduce(InputIterator begin, InputIterator end, OutputType init, BinaryFunction binary_op, thrust::detail::false_type)
 {
   // wrap binary_op
   thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op(binary_op);
@@ -64,6 +255,26 @@ _CCCL_HOST_DEVICE OutputType reduce(
   return result;
 }
 
+} // end namespace reduce_detail
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputType reduce(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputIterator begin,
+  InputIterator end,
+  OutputType init,
+  BinaryFunction binary_op)
+{
+  // a CUDA thread has too few registers to spare for the lanes
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    (reduce_detail::use_reduce_lanes<InputIterator, OutputType, BinaryFunction> use_reduce_lanes;
+     return reduce_detail::reduce(begin, end, init, binary_op, use_reduce_lanes);),
+    ( // NV_IS_DEVICE:
+      return reduce_detail::reduce(begin, end, init, binary_op, thrust::detail::false_type());));
+}
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
@@ -31,7 +31,12 @@
 #endif // no system header
 #include <thrust/detail/copy.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/galloping_search.h>
+
+#include <cuda/std/type_traits>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -41,6 +46,192 @@ namespace detail
 namespace sequential
 {
 
+namespace set_operations_detail
+{
+
+// Moves *first1, *first2 or neither to *result, and advances past the lesser
+// of them, or both if they are equivalent. Elements only in the first input
+// are kept if KeepFirst, elements only in the second input if KeepSecond, and
+// elements of the first input with an equivalent element in the second if
+// KeepBoth.
+_CCCL_EXEC_CHECK_DISABLE
+template <bool KeepFirst,
+          bool KeepSecond,
+          bool KeepBoth,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator set_operation_step(
+  RandomAccessIterator1& first1,
+  RandomAccessIterator2& first2,
+  OutputIterator result,
+  StrictWeakOrdering& comp,
+  thrust::detail::false_type)
+{
+  if (comp(*first1, *first2))
+  {
+    _CCCL_IF_CONSTEXPR (KeepFirst)
+    {
+      *result = *first1;
+      ++result;
+    }
+
+    ++first1;
+  } // end if
+  else if (comp(*first2, *first1))
+  {
+    _CCCL_IF_CONSTEXPR (KeepSecond)
+    {
+      *result = *first2;
+      ++result;
+    }
+
+    ++first2;
+  } // end else if
+  else
+  {
+    _CCCL_IF_CONSTEXPR (KeepBoth)
+    {
+      *result = *first1;
+      ++result;
+    }
+
+    ++first1;
+    ++first2;
+  } // end else
+
+  return result;
+} // end set_operation_step()
+
+// A union writes an element in every step, so arithmetic values can be
+// selected and the inputs advanced without branching.
+_CCCL_EXEC_CHECK_DISABLE
+template <bool KeepFirst,
+          bool KeepSecond,
+          bool KeepBoth,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator set_operation_step(
+  RandomAccessIterator1& first1,
+  RandomAccessIterator2& first2,
+  OutputIterator result,
+  StrictWeakOrdering& comp,
+  thrust::detail::true_type)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  const value_type value1 = *first1;
+  const value_type value2 = *first2;
+
+  const bool less1 = comp(value1, value2);
+  const bool less2 = comp(value2, value1);
+
+  *result = less2 ? value2 : value1;
+  first1 += !less2;
+  first2 += !less1;
+
+  return ++result;
+} // end set_operation_step()
+
+// the other set operations would write past the end of the result
+template <bool KeepFirst,
+          bool KeepSecond,
+          bool KeepBoth,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+struct use_branchless_set_operation_step
+    : ::cuda::std::_And<::cuda::std::integral_constant<bool, KeepFirst && KeepSecond && KeepBoth>,
+                        ::cuda::std::is_arithmetic<typename thrust::iterator_value<RandomAccessIterator1>::type>,
+                        ::cuda::std::is_same<typename thrust::iterator_value<RandomAccessIterator1>::type,
+                                             typename thrust::iterator_value<RandomAccessIterator2>::type>>
+{};
+
+// Computes a set operation of two sorted random access inputs in blocks of
+// galloping_threshold steps. Once a whole block advances through only one of
+// the inputs, the rest of that run is galloped over.
+_CCCL_EXEC_CHECK_DISABLE
+template <bool KeepFirst,
+          bool KeepSecond,
+          bool KeepBoth,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator galloping_set_operation(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  RandomAccessIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
+
+  use_branchless_set_operation_step<KeepFirst, KeepSecond, KeepBoth, RandomAccessIterator1, RandomAccessIterator2>
+    use_branchless;
+
+  // neither input can run out within a block
+  while (last1 - first1 >= galloping_threshold && last2 - first2 >= galloping_threshold)
+  {
+    RandomAccessIterator1 block_first1 = first1;
+    RandomAccessIterator2 block_first2 = first2;
+
+    for (int i = 0; i < galloping_threshold; ++i)
+    {
+      result =
+        set_operation_step<KeepFirst, KeepSecond, KeepBoth>(first1, first2, result, wrapped_comp, use_branchless);
+    } // end for
+
+    if (first2 == block_first2)
+    {
+      // the elements of the first input which are less than *first2
+      RandomAccessIterator1 mid1 = sequential::gallop_lower_bound(exec, first1, last1, *first2, comp);
+
+      _CCCL_IF_CONSTEXPR (KeepFirst)
+      {
+        result = thrust::copy(exec, first1, mid1, result);
+      }
+
+      first1 = mid1;
+    } // end if
+    else if (first1 == block_first1)
+    {
+      // the elements of the second input which are less than *first1
+      RandomAccessIterator2 mid2 = sequential::gallop_lower_bound(exec, first2, last2, *first1, comp);
+
+      _CCCL_IF_CONSTEXPR (KeepSecond)
+      {
+        result = thrust::copy(exec, first2, mid2, result);
+      }
+
+      first2 = mid2;
+    } // end else if
+  } // end while
+
+  while (first1 != last1 && first2 != last2)
+  {
+    result = set_operation_step<KeepFirst, KeepSecond, KeepBoth>(first1, first2, result, wrapped_comp, use_branchless);
+  } // end while
+
+  _CCCL_IF_CONSTEXPR (KeepFirst)
+  {
+    result = thrust::copy(exec, first1, last1, result);
+  }
+
+  _CCCL_IF_CONSTEXPR (KeepSecond)
+  {
+    result = thrust::copy(exec, first2, last2, result);
+  }
+
+  return result;
+} // end galloping_set_operation()
+
 _CCCL_EXEC_CHECK_DISABLE
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -54,7 +245,8 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   InputIterator2 first2,
   InputIterator2 last2,
   OutputIterator result,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
@@ -81,6 +273,25 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   return thrust::copy(exec, first1, last1, result);
 } // end set_difference()
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator set_difference(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  RandomAccessIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  return galloping_set_operation<true, false, false>(exec, first1, last1, first2, last2, result, comp);
+} // end set_difference()
+
 _CCCL_EXEC_CHECK_DISABLE
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -94,7 +305,8 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   InputIterator2 first2,
   InputIterator2 last2,
   OutputIterator result,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
@@ -121,6 +333,25 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   return result;
 } // end set_intersection()
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator set_intersection(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  RandomAccessIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  return galloping_set_operation<false, false, true>(exec, first1, last1, first2, last2, result, comp);
+} // end set_intersection()
+
 _CCCL_EXEC_CHECK_DISABLE
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -134,7 +365,8 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   InputIterator2 first2,
   InputIterator2 last2,
   OutputIterator result,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
@@ -163,6 +395,25 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   return thrust::copy(exec, first2, last2, thrust::copy(exec, first1, last1, result));
 } // end set_symmetric_difference()
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  RandomAccessIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  return galloping_set_operation<true, true, false>(exec, first1, last1, first2, last2, result, comp);
+} // end set_symmetric_difference()
+
 _CCCL_EXEC_CHECK_DISABLE
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -176,7 +427,8 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   InputIterator2 first2,
   InputIterator2 last2,
   OutputIterator result,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
@@ -206,6 +458,107 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   return thrust::copy(exec, first2, last2, thrust::copy(exec, first1, last1, result));
 } // end set_union()
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator set_union(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  RandomAccessIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  return galloping_set_operation<true, true, true>(exec, first1, last1, first2, last2, result, comp);
+} // end set_union()
+
+} // end namespace set_operations_detail
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator set_difference(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  use_galloping<InputIterator1, InputIterator2> gallop;
+
+  return set_operations_detail::set_difference(exec, first1, last1, first2, last2, result, comp, gallop);
+} // end set_difference()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator set_intersection(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  use_galloping<InputIterator1, InputIterator2> gallop;
+
+  return set_operations_detail::set_intersection(exec, first1, last1, first2, last2, result, comp, gallop);
+} // end set_intersection()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  use_galloping<InputIterator1, InputIterator2> gallop;
+
+  return set_operations_detail::set_symmetric_difference(exec, first1, last1, first2, last2, result, comp, gallop);
+} // end set_symmetric_difference()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator set_union(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  use_galloping<InputIterator1, InputIterator2> gallop;
+
+  return set_operations_detail::set_union(exec, first1, last1, first2, last2, result, comp, gallop);
+} // end set_union()
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
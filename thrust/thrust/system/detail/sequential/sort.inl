@@ -26,9 +26,14 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/internal_functional.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/reverse.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/detail/sequential/pdqsort.h>
 #include <thrust/system/detail/sequential/stable_merge_sort.h>
 #include <thrust/system/detail/sequential/stable_primitive_sort.h>
 
@@ -53,12 +58,12 @@ struct needs_reverse : ::cuda::std::is_same<Compare, typename thrust::greater<Ke
 {};
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-_CCCL_HOST_DEVICE void stable_sort(
+_CCCL_HOST_DEVICE void radix_sort(
   sequential::execution_policy<DerivedPolicy>& exec,
   RandomAccessIterator first,
   RandomAccessIterator last,
   StrictWeakOrdering,
-  thrust::detail::true_type)
+  thrust::detail::false_type)
 {
   thrust::system::detail::sequential::stable_primitive_sort(exec, first, last);
 
@@ -75,13 +80,13 @@ template <typename DerivedPolicy,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
           typename StrictWeakOrdering>
-_CCCL_HOST_DEVICE void stable_sort_by_key(
+_CCCL_HOST_DEVICE void radix_sort_by_key(
   sequential::execution_policy<DerivedPolicy>& exec,
   RandomAccessIterator1 first1,
   RandomAccessIterator1 last1,
   RandomAccessIterator2 first2,
   StrictWeakOrdering,
-  thrust::detail::true_type)
+  thrust::detail::false_type)
 {
   // if comp is greater<T> then reverse the keys and values
   using KeyType = typename thrust::iterator_traits<RandomAccessIterator1>::value_type;
@@ -102,6 +107,85 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   }
 }
 
+/////////////////////
+// Decomposer Sort //
+/////////////////////
+
+// keys ordered by a decomposer are radix sorted by its fields. The digits of a
+// descending sort are inverted, so it needs no reversal to remain stable
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void radix_sort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  using KeyType = thrust::iterator_value_t<RandomAccessIterator>;
+  using Digit   = thrust::system::detail::internal::radix_digit<KeyType, StrictWeakOrdering>;
+
+  const size_t N = last - first;
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, N);
+
+  radix_sort_detail::digit_radix_sort<Digit, false>(
+    exec, first, temp.begin(), static_cast<int*>(0), static_cast<int*>(0), N, comp);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void radix_sort_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  using KeyType   = thrust::iterator_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::iterator_value_t<RandomAccessIterator2>;
+  using Digit     = thrust::system::detail::internal::radix_digit<KeyType, StrictWeakOrdering>;
+
+  const size_t N = last1 - first1;
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp1(exec, N);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> temp2(exec, N);
+
+  radix_sort_detail::digit_radix_sort<Digit, true>(exec, first1, temp1.begin(), first2, temp2.begin(), N, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void stable_sort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  thrust::system::detail::internal::is_radix_decomposer<StrictWeakOrdering> is_decomposer;
+
+  sort_detail::radix_sort(exec, first, last, comp, is_decomposer);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void stable_sort_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  thrust::system::detail::internal::is_radix_decomposer<StrictWeakOrdering> is_decomposer;
+
+  sort_detail::radix_sort_by_key(exec, first1, last1, first2, comp, is_decomposer);
+}
+
 ////////////////
 // Merge Sort //
 ////////////////
@@ -132,15 +216,130 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   thrust::system::detail::sequential::stable_merge_sort_by_key(exec, first1, last1, first2, comp);
 }
 
+// stable_radix_sort handles keys of up to 8 bytes; wider keys such as __int128 are merge sorted
 template <typename KeyType, typename Compare>
 struct use_primitive_sort
     : ::cuda::std::_And<::cuda::std::is_arithmetic<KeyType>,
+                        ::cuda::std::bool_constant<sizeof(KeyType) <= 8>,
                         ::cuda::std::disjunction<::cuda::std::is_same<Compare, thrust::less<KeyType>>,
                                                  ::cuda::std::is_same<Compare, thrust::greater<KeyType>>>>
 {};
 
+template <typename KeyType, typename Compare>
+struct use_radix_sort
+    : ::cuda::std::disjunction<use_primitive_sort<KeyType, Compare>,
+                               thrust::system::detail::internal::is_radix_decomposer<Compare>>
+{};
+
+//////////////
+// PDQ Sort //
+//////////////
+
+// primitive keys, and keys ordered by a decomposer, are radix sorted, which is faster than any comparison sort, and
+// happens to be stable
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+sort(sequential::execution_policy<DerivedPolicy>& exec,
+     RandomAccessIterator first,
+     RandomAccessIterator last,
+     StrictWeakOrdering comp,
+     thrust::detail::true_type)
+{
+  sort_detail::stable_sort(exec, first, last, comp, thrust::detail::true_type());
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sort_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, thrust::detail::true_type());
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+sort(sequential::execution_policy<DerivedPolicy>&,
+     RandomAccessIterator first,
+     RandomAccessIterator last,
+     StrictWeakOrdering comp,
+     thrust::detail::false_type)
+{
+  using KeyType = thrust::iterator_value_t<RandomAccessIterator>;
+
+  thrust::system::detail::sequential::pdqsort<pdqsort_detail::use_branchless_partition<KeyType>::value>(
+    first, last, comp);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sort_by_key(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
+{
+  using KeyType   = thrust::iterator_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::iterator_value_t<RandomAccessIterator2>;
+
+  // sort the keys and values together, comparing only the keys
+  auto zipped_first = thrust::make_zip_iterator(thrust::make_tuple(first1, first2));
+
+  thrust::system::detail::sequential::pdqsort<pdqsort_detail::use_branchless_partition<KeyType>::value
+                                              && pdqsort_detail::use_branchless_partition<ValueType>::value>(
+    zipped_first, zipped_first + (last1 - first1), thrust::detail::compare_first<StrictWeakOrdering>(comp));
+}
+
 } // end namespace sort_detail
 
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+sort(sequential::execution_policy<DerivedPolicy>& exec,
+     RandomAccessIterator first,
+     RandomAccessIterator last,
+     StrictWeakOrdering comp)
+{
+  // pdqsort recurses too deeply for the stack of a CUDA thread
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    (using KeyType = thrust::iterator_value_t<RandomAccessIterator>;
+     sort_detail::use_radix_sort<KeyType, StrictWeakOrdering> use_radix_sort;
+     sort_detail::sort(exec, first, last, comp, use_radix_sort);),
+    ( // NV_IS_DEVICE:
+      thrust::system::detail::sequential::stable_sort(exec, first, last, comp);));
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sort_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp)
+{
+  // pdqsort recurses too deeply for the stack of a CUDA thread
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    (using KeyType = thrust::iterator_value_t<RandomAccessIterator1>;
+     sort_detail::use_radix_sort<KeyType, StrictWeakOrdering> use_radix_sort;
+     sort_detail::sort_by_key(exec, first1, last1, first2, comp, use_radix_sort);),
+    ( // NV_IS_DEVICE:
+      thrust::system::detail::sequential::stable_sort_by_key(exec, first1, last1, first2, comp);));
+}
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
 _CCCL_HOST_DEVICE void stable_sort(
   sequential::execution_policy<DerivedPolicy>& exec,
@@ -152,11 +351,11 @@ _CCCL_HOST_DEVICE void stable_sort(
   NV_IF_TARGET(
     NV_IS_HOST,
     (using KeyType = thrust::iterator_value_t<RandomAccessIterator>;
-     sort_detail::use_primitive_sort<KeyType, StrictWeakOrdering> use_primitive_sort;
-     sort_detail::stable_sort(exec, first, last, comp, use_primitive_sort);),
+     sort_detail::use_radix_sort<KeyType, StrictWeakOrdering> use_radix_sort;
+     sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);),
     ( // NV_IS_DEVICE:
-      thrust::detail::false_type use_primitive_sort;
-      sort_detail::stable_sort(exec, first, last, comp, use_primitive_sort);));
+      thrust::detail::false_type use_radix_sort;
+      sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);));
 }
 
 template <typename DerivedPolicy,
@@ -174,11 +373,11 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   NV_IF_TARGET(
     NV_IS_HOST,
     (using KeyType = thrust::iterator_value_t<RandomAccessIterator1>;
-     sort_detail::use_primitive_sort<KeyType, StrictWeakOrdering> use_primitive_sort;
-     sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_primitive_sort);),
+     sort_detail::use_radix_sort<KeyType, StrictWeakOrdering> use_radix_sort;
+     sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_radix_sort);),
     ( // NV_IS_DEVICE:
-      thrust::detail::false_type use_primitive_sort;
-      sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_primitive_sort);));
+      thrust::detail::false_type use_radix_sort;
+      sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_radix_sort);));
 }
 
 } // end namespace sequential
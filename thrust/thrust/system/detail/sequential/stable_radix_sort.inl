@@ -27,15 +27,15 @@
 #endif // no system header
 
 #include <thrust/copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/iterator/transform_iterator.h>
-#include <thrust/iterator/zip_iterator.h>
-#include <thrust/scatter.h>
 
 #include <cuda/std/utility>
 
+#include <nv/target>
+
 #include <cstdint>
 #include <limits>
 
@@ -95,7 +95,7 @@ struct RadixEncoder<short>
 template <>
 struct RadixEncoder<int>
 {
-  _CCCL_HOST_DEVICE unsigned long operator()(long x) const
+  _CCCL_HOST_DEVICE unsigned int operator()(int x) const
   {
     return x ^ static_cast<unsigned int>(1) << (8 * sizeof(unsigned int) - 1);
   }
@@ -152,88 +152,151 @@ struct RadixEncoder<double>
   }
 };
 
-// this functor returns a key's to its histogram bucket count and post-increments the bucket
+// XXX these values are a tuning opportunity
+// 8-byte keys are sorted with wide_radix_bits wide digits when there are at least this many
+const static size_t wide_digit_threshold = 1 << 21;
+// the width of the digits of large inputs of 8-byte keys, which take six passes rather than 16 or 22
+const static unsigned int wide_radix_bits = 11;
+// the number of bytes of keys collected per bucket before they are written out together
+const static size_t write_combining_bytes = 128;
+// keys-only sorts whose temporary copy of the input would be larger than this are sorted in place
+const static size_t in_place_threshold = size_t(1) << 30;
+// the in-place sort insertion sorts buckets smaller than this
+const static size_t in_place_insertion_threshold = 32;
+
+// this functor returns the digit of a key which a radix pass sorts by
 template <unsigned int RadixBits, typename KeyType>
-struct bucket_functor
+struct digit_functor
 {
   using Encoder                    = RadixEncoder<KeyType>;
   using EncodedType                = decltype(::cuda::std::declval<Encoder>()(::cuda::std::declval<KeyType>()));
-  using result_type                = size_t;
   static const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
 
   Encoder encode;
-  EncodedType bit_shift;
-  size_t* histogram;
+  unsigned int bit_shift;
 
-  _CCCL_HOST_DEVICE bucket_functor(EncodedType bit_shift, size_t* histogram)
+  _CCCL_HOST_DEVICE explicit digit_functor(unsigned int bit_shift)
       : encode()
       , bit_shift(bit_shift)
-      , histogram(histogram)
   {}
 
-  inline _CCCL_HOST_DEVICE size_t operator()(KeyType key)
+  inline _CCCL_HOST_DEVICE size_t operator()(const KeyType& key) const
   {
-    const EncodedType x = encode(key);
-
-    // note that we mutate the histogram here
-    return histogram[(x >> bit_shift) & BitMask]++;
+    return static_cast<size_t>((encode(key) >> bit_shift) & BitMask);
   }
 };
 
-template <unsigned int RadixBits,
-          typename DerivedPolicy,
+// scatters the keys and (optionally) values to the positions in histogram of their digits, which is mutated
+template <bool HasValues,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
-          typename Integer>
-inline _CCCL_HOST_DEVICE void radix_shuffle_n(
-  sequential::execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Digit>
+_CCCL_HOST_DEVICE void radix_shuffle_n(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
   const size_t n,
-  RandomAccessIterator2 result,
-  Integer bit_shift,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4 values_result,
+  Digit digit,
   size_t* histogram)
 {
-  using KeyType = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  for (size_t i = 0; i < n; i++)
+  {
+    const size_t position = histogram[digit(keys_first[i])]++;
+
+    keys_result[position] = keys_first[i];
 
-  // note that we are going to mutate the histogram during this sequential scatter
-  thrust::scatter(
-    exec,
-    first,
-    first + n,
-    thrust::make_transform_iterator(first, bucket_functor<RadixBits, KeyType>(bit_shift, histogram)),
-    result);
+    if (HasValues)
+    {
+      values_result[position] = values_first[i];
+    }
+  }
 }
 
+// Like radix_shuffle_n, but the keys and values of each bucket are first collected in a buffer of BufferSize
+// elements, and written out once it is full. Only the buffers are written in random order, and they stay in cache,
+// while the output is written in runs of whole cache lines instead of single elements which miss the cache and
+// TLB once there are many buckets.
 template <unsigned int RadixBits,
-          typename DerivedPolicy,
+          bool HasValues,
+          size_t BufferSize,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
           typename RandomAccessIterator3,
           typename RandomAccessIterator4,
-          typename Integer>
+          typename KeyType,
+          typename ValueType>
 _CCCL_HOST_DEVICE void radix_shuffle_n(
-  sequential::execution_policy<DerivedPolicy>& exec,
   RandomAccessIterator1 keys_first,
   RandomAccessIterator2 values_first,
   const size_t n,
   RandomAccessIterator3 keys_result,
   RandomAccessIterator4 values_result,
-  Integer bit_shift,
-  size_t* histogram)
+  digit_functor<RadixBits, KeyType> digit,
+  size_t* histogram,
+  KeyType* key_buffers,
+  ValueType* value_buffers)
 {
-  using KeyType = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  const unsigned int HistogramSize = 1 << RadixBits;
+
+  // the number of elements in each buffer
+  size_t fill[HistogramSize] = {0};
+
+  for (size_t i = 0; i < n; i++)
+  {
+    const size_t bucket = digit(keys_first[i]);
+    const size_t slot   = bucket * BufferSize + fill[bucket];
+
+    key_buffers[slot] = keys_first[i];
+
+    if (HasValues)
+    {
+      value_buffers[slot] = values_first[i];
+    }
+
+    if (++fill[bucket] == BufferSize)
+    {
+      const size_t position = histogram[bucket];
+
+      for (size_t j = 0; j < BufferSize; j++)
+      {
+        keys_result[position + j] = key_buffers[bucket * BufferSize + j];
+
+        if (HasValues)
+        {
+          values_result[position + j] = value_buffers[bucket * BufferSize + j];
+        }
+      }
 
-  // note that we are going to mutate the histogram during this sequential scatter
-  thrust::scatter(
-    exec,
-    thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first)),
-    thrust::make_zip_iterator(thrust::make_tuple(keys_first + n, values_first + n)),
-    thrust::make_transform_iterator(keys_first, bucket_functor<RadixBits, KeyType>(bit_shift, histogram)),
-    thrust::make_zip_iterator(thrust::make_tuple(keys_result, values_result)));
+      histogram[bucket] = position + BufferSize;
+      fill[bucket]      = 0;
+    }
+  }
+
+  // write out what is left in the buffers
+  for (unsigned int bucket = 0; bucket < HistogramSize; bucket++)
+  {
+    const size_t position = histogram[bucket];
+
+    for (size_t j = 0; j < fill[bucket]; j++)
+    {
+      keys_result[position + j] = key_buffers[bucket * BufferSize + j];
+
+      if (HasValues)
+      {
+        values_result[position + j] = value_buffers[bucket * BufferSize + j];
+      }
+    }
+  }
 }
 
+// a stable LSD radix sort of keys1 (and vals1), using keys2 (and vals2) as temporary storage. Unless BufferSize is
+// zero, the passes go through write-combining buffers of BufferSize elements per bucket
 template <unsigned int RadixBits,
           bool HasValues,
+          size_t BufferSize,
           typename DerivedPolicy,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
@@ -247,12 +310,13 @@ _CCCL_HOST_DEVICE void radix_sort(
   RandomAccessIterator4 vals2,
   const size_t N)
 {
-  using KeyType = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using KeyType   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using ValueType = typename thrust::iterator_value<RandomAccessIterator3>::type;
 
   using Encoder     = RadixEncoder<KeyType>;
   using EncodedType = decltype(::cuda::std::declval<Encoder>()(::cuda::std::declval<KeyType>()));
 
-  const unsigned int NumHistograms = (8 * sizeof(EncodedType) + (RadixBits - 1)) / RadixBits;
+  const unsigned int NumHistograms = (8 * sizeof(KeyType) + (RadixBits - 1)) / RadixBits;
   const unsigned int HistogramSize = 1 << RadixBits;
 
   const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
@@ -300,33 +364,57 @@ _CCCL_HOST_DEVICE void radix_sort(
     }
   }
 
+  // storage for write-combining buffers
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> key_buffers(
+    exec, BufferSize ? HistogramSize * BufferSize : 0);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> value_buffers(
+    exec, BufferSize && HasValues ? HistogramSize * BufferSize : 0);
+
   // shuffle keys and (optionally) values
   for (unsigned int i = 0; i < NumHistograms; i++)
   {
-    const EncodedType BitShift = static_cast<EncodedType>(RadixBits * i);
+    const digit_functor<RadixBits, KeyType> digit(RadixBits * i);
 
     if (!skip_shuffle[i])
     {
-      if (flip)
+      if (BufferSize == 0)
       {
-        if (HasValues)
+        if (flip)
         {
-          radix_shuffle_n<RadixBits>(exec, keys2, vals2, N, keys1, vals1, BitShift, histograms[i]);
+          radix_shuffle_n<HasValues>(keys2, vals2, N, keys1, vals1, digit, histograms[i]);
         }
         else
         {
-          radix_shuffle_n<RadixBits>(exec, keys2, N, keys1, BitShift, histograms[i]);
+          radix_shuffle_n<HasValues>(keys1, vals1, N, keys2, vals2, digit, histograms[i]);
         }
       }
       else
       {
-        if (HasValues)
+        if (flip)
         {
-          radix_shuffle_n<RadixBits>(exec, keys1, vals1, N, keys2, vals2, BitShift, histograms[i]);
+          radix_shuffle_n<RadixBits, HasValues, (BufferSize ? BufferSize : 1)>(
+            keys2,
+            vals2,
+            N,
+            keys1,
+            vals1,
+            digit,
+            histograms[i],
+            thrust::raw_pointer_cast(key_buffers.data()),
+            thrust::raw_pointer_cast(value_buffers.data()));
         }
         else
         {
-          radix_shuffle_n<RadixBits>(exec, keys1, N, keys2, BitShift, histograms[i]);
+          radix_shuffle_n<RadixBits, HasValues, (BufferSize ? BufferSize : 1)>(
+            keys1,
+            vals1,
+            N,
+            keys2,
+            vals2,
+            digit,
+            histograms[i],
+            thrust::raw_pointer_cast(key_buffers.data()),
+            thrust::raw_pointer_cast(value_buffers.data()));
         }
       }
 
@@ -347,7 +435,6 @@ _CCCL_HOST_DEVICE void radix_sort(
 }
 
 // Select best radix sort parameters based on sizeof(T) and input size
-// These particular values were determined through empirical testing on a Core i7 950 CPU
 template <size_t KeySize>
 struct radix_sort_dispatcher
 {};
@@ -355,17 +442,8 @@ struct radix_sort_dispatcher
 template <>
 struct radix_sort_dispatcher<1>
 {
-  template <typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
-  _CCCL_HOST_DEVICE void operator()(
-    sequential::execution_policy<DerivedPolicy>& exec,
-    RandomAccessIterator1 keys1,
-    RandomAccessIterator2 keys2,
-    const size_t N)
-  {
-    radix_sort_detail::radix_sort<8, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
-  }
-
-  template <typename DerivedPolicy,
+  template <bool HasValues,
+            typename DerivedPolicy,
             typename RandomAccessIterator1,
             typename RandomAccessIterator2,
             typename RandomAccessIterator3,
@@ -378,37 +456,16 @@ struct radix_sort_dispatcher<1>
     RandomAccessIterator4 vals2,
     const size_t N)
   {
-    radix_sort_detail::radix_sort<8, true>(exec, keys1, keys2, vals1, vals2, N);
+    radix_sort_detail::radix_sort<8, HasValues, 0>(exec, keys1, keys2, vals1, vals2, N);
   }
 };
 
+// These particular values were determined through empirical testing on a Core i7 950 CPU
 template <>
 struct radix_sort_dispatcher<2>
 {
-  template <typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
-  _CCCL_HOST_DEVICE void operator()(
-    sequential::execution_policy<DerivedPolicy>& exec,
-    RandomAccessIterator1 keys1,
-    RandomAccessIterator2 keys2,
-    const size_t N)
-  {
-#ifdef __QNX__
-    // XXX war for nvbug 200193674
-    const bool condition = true;
-#else
-    const bool condition = N < (1 << 16);
-#endif
-    if (condition)
-    {
-      radix_sort_detail::radix_sort<8, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
-    }
-    else
-    {
-      radix_sort_detail::radix_sort<16, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
-    }
-  }
-
-  template <typename DerivedPolicy,
+  template <bool HasValues,
+            typename DerivedPolicy,
             typename RandomAccessIterator1,
             typename RandomAccessIterator2,
             typename RandomAccessIterator3,
@@ -425,15 +482,15 @@ struct radix_sort_dispatcher<2>
     // XXX war for nvbug 200193674
     const bool condition = true;
 #else
-    const bool condition = N < (1 << 15);
+    const bool condition = N < (HasValues ? (1 << 15) : (1 << 16));
 #endif
     if (condition)
     {
-      radix_sort_detail::radix_sort<8, true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<8, HasValues, 0>(exec, keys1, keys2, vals1, vals2, N);
     }
     else
     {
-      radix_sort_detail::radix_sort<16, true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<16, HasValues, 0>(exec, keys1, keys2, vals1, vals2, N);
     }
   }
 };
@@ -441,24 +498,8 @@ struct radix_sort_dispatcher<2>
 template <>
 struct radix_sort_dispatcher<4>
 {
-  template <typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
-  _CCCL_HOST_DEVICE void operator()(
-    sequential::execution_policy<DerivedPolicy>& exec,
-    RandomAccessIterator1 keys1,
-    RandomAccessIterator2 keys2,
-    const size_t N)
-  {
-    if (N < (1 << 22))
-    {
-      radix_sort_detail::radix_sort<8, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
-    }
-    else
-    {
-      radix_sort_detail::radix_sort<4, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
-    }
-  }
-
-  template <typename DerivedPolicy,
+  template <bool HasValues,
+            typename DerivedPolicy,
             typename RandomAccessIterator1,
             typename RandomAccessIterator2,
             typename RandomAccessIterator3,
@@ -473,36 +514,22 @@ struct radix_sort_dispatcher<4>
   {
     if (N < (1 << 22))
     {
-      radix_sort_detail::radix_sort<8, true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<8, HasValues, 0>(exec, keys1, keys2, vals1, vals2, N);
     }
     else
     {
-      radix_sort_detail::radix_sort<3, true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<HasValues ? 3 : 4, HasValues, 0>(exec, keys1, keys2, vals1, vals2, N);
     }
   }
 };
 
+// On large inputs, wide digits take less than half as many passes over 8-byte keys as the narrow ones, but their 2048
+// buckets are too many to scatter to directly, so those passes are write-combined.
 template <>
 struct radix_sort_dispatcher<8>
 {
-  template <typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
-  _CCCL_HOST_DEVICE void operator()(
-    sequential::execution_policy<DerivedPolicy>& exec,
-    RandomAccessIterator1 keys1,
-    RandomAccessIterator2 keys2,
-    const size_t N)
-  {
-    if (N < (1 << 21))
-    {
-      radix_sort_detail::radix_sort<8, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
-    }
-    else
-    {
-      radix_sort_detail::radix_sort<4, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
-    }
-  }
-
-  template <typename DerivedPolicy,
+  template <bool HasValues,
+            typename DerivedPolicy,
             typename RandomAccessIterator1,
             typename RandomAccessIterator2,
             typename RandomAccessIterator3,
@@ -515,13 +542,14 @@ struct radix_sort_dispatcher<8>
     RandomAccessIterator4 vals2,
     const size_t N)
   {
-    if (N < (1 << 21))
+    if (N < wide_digit_threshold)
     {
-      radix_sort_detail::radix_sort<8, true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<8, HasValues, 0>(exec, keys1, keys2, vals1, vals2, N);
     }
     else
     {
-      radix_sort_detail::radix_sort<3, true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<wide_radix_bits, HasValues, write_combining_bytes / 8>(
+        exec, keys1, keys2, vals1, vals2, N);
     }
   }
 };
@@ -534,7 +562,8 @@ _CCCL_HOST_DEVICE void radix_sort(
   const size_t N)
 {
   using KeyType = typename thrust::iterator_value<RandomAccessIterator1>::type;
-  radix_sort_dispatcher<sizeof(KeyType)>()(exec, keys1, keys2, N);
+  radix_sort_dispatcher<sizeof(KeyType)>().template operator()<false>(
+    exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
 }
 
 template <typename DerivedPolicy,
@@ -551,7 +580,197 @@ _CCCL_HOST_DEVICE void radix_sort(
   const size_t N)
 {
   using KeyType = typename thrust::iterator_value<RandomAccessIterator1>::type;
-  radix_sort_dispatcher<sizeof(KeyType)>()(exec, keys1, keys2, vals1, vals2, N);
+  radix_sort_dispatcher<sizeof(KeyType)>().template operator()<true>(exec, keys1, keys2, vals1, vals2, N);
+}
+
+// A stable LSD radix sort of keys1 (and vals1) by the 8-bit digits which Digit(pass, comp) extracts from the keys,
+// such as those of the fields of a decomposed key, using keys2 (and vals2) as temporary storage.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Digit,
+          bool HasValues,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Compare>
+_CCCL_HOST_DEVICE void digit_radix_sort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys1,
+  RandomAccessIterator2 keys2,
+  RandomAccessIterator3 vals1,
+  RandomAccessIterator4 vals2,
+  const size_t N,
+  Compare comp)
+{
+  const unsigned int NumHistograms = Digit::num_passes;
+  const unsigned int HistogramSize = Digit::num_buckets;
+
+  // storage for histograms
+  size_t histograms[NumHistograms][HistogramSize] = {{0}};
+
+  // see which passes can be eliminated
+  bool skip_shuffle[NumHistograms] = {false};
+
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
+
+  // compute histograms
+  for (size_t i = 0; i < N; i++)
+  {
+    for (unsigned int j = 0; j < NumHistograms; j++)
+    {
+      histograms[j][Digit(j, comp)(keys1[i])]++;
+    }
+  }
+
+  // scan histograms
+  for (unsigned int i = 0; i < NumHistograms; i++)
+  {
+    size_t sum = 0;
+
+    for (unsigned int j = 0; j < HistogramSize; j++)
+    {
+      size_t bin = histograms[i][j];
+
+      if (bin == N)
+      {
+        skip_shuffle[i] = true;
+      }
+
+      histograms[i][j] = sum;
+
+      sum = sum + bin;
+    }
+  }
+
+  // shuffle keys and (optionally) values
+  for (unsigned int i = 0; i < NumHistograms; i++)
+  {
+    if (!skip_shuffle[i])
+    {
+      if (flip)
+      {
+        radix_shuffle_n<HasValues>(keys2, vals2, N, keys1, vals1, Digit(i, comp), histograms[i]);
+      }
+      else
+      {
+        radix_shuffle_n<HasValues>(keys1, vals1, N, keys2, vals2, Digit(i, comp), histograms[i]);
+      }
+
+      flip = (flip) ? false : true;
+    }
+  }
+
+  // ensure final values are in (keys1,vals1)
+  if (flip)
+  {
+    thrust::copy(exec, keys2, keys2 + N, keys1);
+
+    if (HasValues)
+    {
+      thrust::copy(exec, vals2, vals2 + N, vals1);
+    }
+  }
+}
+
+// An in-place MSD radix sort ("American flag sort") of the keys by the digits at bit_shift and below. Each pass
+// counts the 8-bit digits of a range and then swaps every key directly into its bucket, so no temporary storage is
+// needed. It is not stable, which is only observable if there are values. It recurses with a histogram on the stack
+// at every level, which is too much for the stack of a CUDA thread, so it is only used on the host.
+template <typename RandomAccessIterator>
+void in_place_radix_sort(RandomAccessIterator keys, const size_t N, unsigned int bit_shift)
+{
+  using KeyType = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  const unsigned int HistogramSize = 1 << 8;
+
+  RadixEncoder<KeyType> encode;
+
+  if (N < in_place_insertion_threshold)
+  {
+    for (size_t i = 1; i < N; i++)
+    {
+      const KeyType key = keys[i];
+
+      size_t j = i;
+      for (; j > 0 && encode(key) < encode(keys[j - 1]); j--)
+      {
+        keys[j] = keys[j - 1];
+      }
+
+      keys[j] = key;
+    }
+
+    return;
+  }
+
+  digit_functor<8, KeyType> digit(bit_shift);
+
+  size_t begin[HistogramSize] = {0};
+  size_t end[HistogramSize];
+
+  for (size_t i = 0; i < N; i++)
+  {
+    begin[digit(keys[i])]++;
+  }
+
+  // the pass can be skipped if all keys share the digit
+  bool skip_shuffle = false;
+
+  size_t sum = 0;
+
+  for (unsigned int j = 0; j < HistogramSize; j++)
+  {
+    skip_shuffle = skip_shuffle || begin[j] == N;
+
+    end[j]   = sum + begin[j];
+    begin[j] = sum;
+    sum      = end[j];
+  }
+
+  if (!skip_shuffle)
+  {
+    // begin[j] is the first position of bucket j which may not hold a key of the bucket yet
+    for (unsigned int j = 0; j < HistogramSize; j++)
+    {
+      while (begin[j] < end[j])
+      {
+        const size_t d = digit(keys[begin[j]]);
+
+        if (d == j)
+        {
+          begin[j]++;
+        }
+        else
+        {
+          const KeyType key  = keys[begin[j]];
+          keys[begin[j]]     = keys[begin[d]];
+          keys[begin[d]++]   = key;
+        }
+      }
+    }
+  }
+
+  if (bit_shift == 0)
+  {
+    return;
+  }
+
+  // sort each bucket by the remaining digits
+  size_t bucket_begin = 0;
+
+  for (unsigned int j = 0; j < HistogramSize; j++)
+  {
+    const size_t bucket_size = end[j] - bucket_begin;
+
+    if (bucket_size > 1)
+    {
+      radix_sort_detail::in_place_radix_sort(keys + bucket_begin, bucket_size, bit_shift - 8);
+    }
+
+    bucket_begin = end[j];
+  }
 }
 
 } // namespace radix_sort_detail
@@ -564,6 +783,15 @@ _CCCL_HOST_DEVICE void stable_radix_sort(
 
   size_t N = last - first;
 
+  // only values could tell the difference between a stable and an unstable sort, so the keys are sorted in place
+  // rather than allocate a large temporary copy
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    (if (N * sizeof(KeyType) > radix_sort_detail::in_place_threshold) {
+      radix_sort_detail::in_place_radix_sort(first, N, 8 * sizeof(KeyType) - 8);
+      return;
+    }));
+
   thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, N);
 
   radix_sort_detail::radix_sort(exec, first, temp.begin(), N);
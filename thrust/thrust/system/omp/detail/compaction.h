@@ -0,0 +1,116 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file compaction.h
+ *  \brief Parallel stream compaction shared by the OpenMP algorithms.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// counts the heads of the runs of equal elements in a tile. an element is the
+// head of a run if it is the first one or not equal to its predecessor
+template <typename InputIterator, typename BinaryPredicate>
+struct count_run_heads
+{
+  InputIterator first;
+  BinaryPredicate binary_pred;
+
+  count_run_heads(InputIterator first, BinaryPredicate binary_pred)
+      : first(first)
+      , binary_pred(binary_pred)
+  {}
+
+  template <typename Range>
+  typename Range::index_type operator()(const Range& r) const
+  {
+    using Size = typename Range::index_type;
+
+    thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_binary_pred(binary_pred);
+
+    Size count = 0;
+
+    for (Size i = r.begin(); i != r.end(); ++i)
+    {
+      if (i == 0 || !wrapped_binary_pred(first[i - 1], first[i]))
+      {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+};
+
+// Two-pass parallel stream compaction over the tiles of decomp:
+// count(range) returns the number of outputs of a tile, and after an
+// exclusive scan of the counts write(range, offset, total) produces them
+// starting at output position offset, where total is the number of outputs
+// of all tiles. Returns that total.
+template <typename DerivedPolicy, typename Size, typename CountFunction, typename WriteFunction>
+Size compact_tiles(execution_policy<DerivedPolicy>& exec,
+                   const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+                   CountFunction count,
+                   WriteFunction write);
+
+// In-place parallel stream compaction of [first, first + n): compact(range)
+// compacts a tile to its front and returns the number of elements it kept,
+// then the kept elements of all tiles are gathered at the front of the range.
+// The elements behind them are left in an unspecified state. Returns the
+// number of elements kept.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename CompactFunction>
+Size compact_tiles_in_place(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+  CompactFunction compact);
+
+// Like compact_tiles_in_place, but partition(range) stably partitions a tile
+// and the elements which are not kept are gathered behind the kept ones in
+// their original order.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename PartitionFunction>
+Size partition_tiles_in_place(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+  PartitionFunction partition);
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/omp/detail/compaction.inl>
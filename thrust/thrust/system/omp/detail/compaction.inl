@@ -0,0 +1,309 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/compaction.h>
+#include <thrust/system/omp/detail/parallel_for.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename Size, typename CountFunction, typename WriteFunction>
+Size compact_tiles(execution_policy<DerivedPolicy>& exec,
+                   const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+                   CountFunction count,
+                   WriteFunction write)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<CountFunction,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  Size result = 0;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using index_type = std::intptr_t;
+
+  index_type nseg = static_cast<index_type>(decomp.size());
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, nseg + 1);
+
+  Size* raw_offsets = thrust::raw_pointer_cast(offsets.data());
+
+  // every thread counts the outputs of its own tile
+  omp::detail::parallel_for(exec, nseg, [&](index_type i) {
+    raw_offsets[i + 1] = count(decomp[i]);
+  });
+
+  // scan the counts
+  raw_offsets[0] = 0;
+
+  for (index_type i = 0; i < nseg; i++)
+  {
+    raw_offsets[i + 1] += raw_offsets[i];
+  }
+
+  // every thread writes the outputs of its own tile
+  omp::detail::parallel_for(exec, nseg, [&](index_type i) {
+    write(decomp[i], raw_offsets[i], raw_offsets[nseg]);
+  });
+
+  result = raw_offsets[nseg];
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result;
+}
+
+namespace compaction_detail
+{
+
+// returns the start of the share-th of num_shares equal parts of [0, n)
+template <typename Size>
+Size share_begin(Size n, std::intptr_t share, std::intptr_t num_shares)
+{
+  return static_cast<Size>(static_cast<std::intmax_t>(n) * share / num_shares);
+}
+
+// does the share-th of num_shares equal parts of reversing [first, first + n)
+template <typename RandomAccessIterator, typename Size>
+void reverse_share(RandomAccessIterator first, Size n, std::intptr_t share, std::intptr_t num_shares)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  Size lo = share_begin<Size>(n / 2, share, num_shares);
+  Size hi = share_begin<Size>(n / 2, share + 1, num_shares);
+
+  // exchange through a value rather than with swap, which does not exchange
+  // the elements behind the references of a zip_iterator
+  for (Size i = lo; i != hi; ++i)
+  {
+    value_type temp  = first[i];
+    first[i]         = first[n - 1 - i];
+    first[n - 1 - i] = temp;
+  }
+}
+
+// does the share-th of num_shares equal parts of copying [first, first + n) to result
+template <typename RandomAccessIterator, typename Size>
+void copy_share(
+  RandomAccessIterator first, Size n, RandomAccessIterator result, std::intptr_t share, std::intptr_t num_shares)
+{
+  Size lo = share_begin<Size>(n, share, num_shares);
+  Size hi = share_begin<Size>(n, share + 1, num_shares);
+
+  thrust::copy(thrust::seq, first + lo, first + hi, result + lo);
+}
+
+// returns whether any of the merges of pairs of groups of width tiles, which
+// may overwrite the rest of the left group, needs a rotation rather than a copy
+template <typename Size>
+bool rotates_any(const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+                 const Size* counts,
+                 std::intptr_t width)
+{
+  for (std::intptr_t i = 0; i + width < static_cast<std::intptr_t>(decomp.size()); i += 2 * width)
+  {
+    Size begin = decomp[i].begin() + counts[i];
+    Size mid   = decomp[i + width].begin();
+
+    if (begin != mid && mid - begin < counts[i + width])
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Gathers the elements kept by the tiles of decomp, of which counts[i] sit at
+// the front of tile i, at the front of [first, first + n) and returns how many
+// there are.
+//
+// Every round merges pairs of neighbouring groups of tiles, so that the groups
+// double in size. The kept elements of the right group are moved in front of
+// the rest of the left group: with a copy if that does not overlap and the rest
+// need not be preserved, and otherwise by rotating them past the rest, which is
+// reversing both and then their concatenation. The moves of a round are split
+// into as many shares as there are tiles, so every round runs on all threads.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size>
+Size gather_tiles(execution_policy<DerivedPolicy>& exec,
+                  RandomAccessIterator first,
+                  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+                  Size* counts,
+                  bool preserve_rest)
+{
+  using index_type = std::intptr_t;
+
+  index_type nseg = static_cast<index_type>(decomp.size());
+
+  for (index_type width = 1; width < nseg; width *= 2)
+  {
+    // there are 2 * width shares of the merge of every pair of groups, and
+    // share j % (2 * width) belongs to the pair which starts at tile
+    // j - j % (2 * width). the kept elements of the right group are
+    // [mid, end) and the rest of the left group is [begin, mid)
+    index_type num_shares = (nseg + 2 * width - 1) / (2 * width) * (2 * width);
+
+    auto merge = [&](index_type j, bool second_phase) {
+      index_type share = j % (2 * width);
+      index_type i     = j - share;
+
+      if (i + width >= nseg)
+      {
+        return;
+      }
+
+      Size begin = decomp[i].begin() + counts[i];
+      Size mid   = decomp[i + width].begin();
+      Size end   = mid + counts[i + width];
+
+      if (begin == mid || mid == end)
+      {
+        return;
+      }
+
+      if (!preserve_rest && end - mid <= mid - begin)
+      {
+        if (!second_phase)
+        {
+          copy_share(first + mid, end - mid, first + begin, share, 2 * width);
+        }
+      }
+      else if (!second_phase)
+      {
+        reverse_share(first + begin, mid - begin, share, 2 * width);
+        reverse_share(first + mid, end - mid, share, 2 * width);
+      }
+      else
+      {
+        reverse_share(first + begin, end - begin, share, 2 * width);
+      }
+    };
+
+    omp::detail::parallel_for(exec, num_shares, [&](index_type j) {
+      merge(j, false);
+    });
+
+    if (preserve_rest || rotates_any(decomp, counts, width))
+    {
+      omp::detail::parallel_for(exec, num_shares, [&](index_type j) {
+        merge(j, true);
+      });
+    }
+
+    for (index_type i = 0; i + width < nseg; i += 2 * width)
+    {
+      counts[i] += counts[i + width];
+    }
+  }
+
+  return counts[0];
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename CompactFunction>
+Size compact_and_gather_tiles(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+  CompactFunction compact,
+  bool preserve_rest)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  Size result = 0;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using index_type = std::intptr_t;
+
+  index_type nseg = static_cast<index_type>(decomp.size());
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> counts(exec, nseg);
+
+  Size* raw_counts = thrust::raw_pointer_cast(counts.data());
+
+  // every thread compacts its own tile
+  omp::detail::parallel_for(exec, nseg, [&](index_type i) {
+    raw_counts[i] = compact(decomp[i]);
+  });
+
+  result = compaction_detail::gather_tiles(exec, first, decomp, raw_counts, preserve_rest);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result;
+}
+
+} // namespace compaction_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename CompactFunction>
+Size compact_tiles_in_place(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+  CompactFunction compact)
+{
+  return compaction_detail::compact_and_gather_tiles(exec, first, decomp, compact, false);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename PartitionFunction>
+Size partition_tiles_in_place(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+  PartitionFunction partition)
+{
+  return compaction_detail::compact_and_gather_tiles(exec, first, decomp, partition, true);
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -27,8 +27,15 @@
 #endif // no system header
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/system/detail/generic/copy.h>
+#include <thrust/system/detail/internal/trivial_copy.h>
 #include <thrust/system/detail/sequential/copy.h>
+#include <thrust/system/detail/sequential/trivial_copy.h>
 #include <thrust/system/omp/detail/copy.h>
+#include <thrust/system/omp/detail/parallel_for.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+#include <cstddef>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -37,6 +44,56 @@ namespace omp
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+template <typename DerivedPolicy, typename T>
+T* trivial_copy_n(execution_policy<DerivedPolicy>& exec, const T* first, std::ptrdiff_t n, T* result)
+{
+  if (!thrust::system::detail::internal::use_parallel_trivial_copy(first, n, result))
+  {
+    return thrust::system::detail::sequential::trivial_copy_n(first, n, result);
+  }
+
+  const std::size_t bytes         = static_cast<std::size_t>(n) * sizeof(T);
+  const std::ptrdiff_t num_chunks =
+    static_cast<std::ptrdiff_t>(thrust::system::detail::internal::trivial_copy_num_chunks(bytes));
+
+  // the chunks are handed out to the threads with the policy's schedule, so
+  // with the default static schedule each thread writes a contiguous part
+  // of the output, like it does in the other omp algorithms
+  omp::detail::parallel_for(exec, num_chunks, [=](std::ptrdiff_t i) {
+    thrust::system::detail::internal::trivial_copy_chunk(first, result, bytes, static_cast<std::size_t>(i));
+  });
+
+  return result + n;
+} // end trivial_copy_n()
+
+// contiguous ranges of trivially relocatable elements are copied with memcpy
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
+OutputIterator copy_n(execution_policy<DerivedPolicy>& exec,
+                      InputIterator first,
+                      Size n,
+                      OutputIterator result,
+                      thrust::detail::true_type) // is_indirectly_trivially_relocatable_to
+{
+  copy_detail::trivial_copy_n(
+    exec, thrust::unwrap_contiguous_iterator(first), n, thrust::unwrap_contiguous_iterator(result));
+  return result + n;
+} // end copy_n()
+
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
+OutputIterator copy_n(execution_policy<DerivedPolicy>& exec,
+                      InputIterator first,
+                      Size n,
+                      OutputIterator result,
+                      thrust::detail::false_type) // is_indirectly_trivially_relocatable_to
+{
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
+} // namespace copy_detail
+
 namespace dispatch
 {
 
@@ -59,7 +116,12 @@ copy(execution_policy<DerivedPolicy>& exec,
      OutputIterator result,
      thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return copy_detail::copy_n(
+    exec,
+    first,
+    last - first,
+    result,
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::type());
 } // end copy()
 
 template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
@@ -81,7 +143,12 @@ copy_n(execution_policy<DerivedPolicy>& exec,
        OutputIterator result,
        thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return copy_detail::copy_n(
+    exec,
+    first,
+    n,
+    result,
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::type());
 } // end copy_n()
 
 } // namespace dispatch
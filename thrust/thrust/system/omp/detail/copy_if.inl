@@ -25,8 +25,14 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/detail/seq.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/compaction.h>
 #include <thrust/system/omp/detail/copy_if.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -35,6 +41,50 @@ namespace omp
 {
 namespace detail
 {
+namespace copy_if_detail
+{
+
+template <typename InputIterator, typename Predicate>
+struct count_tile
+{
+  InputIterator stencil;
+  Predicate pred;
+
+  count_tile(InputIterator stencil, Predicate pred)
+      : stencil(stencil)
+      , pred(pred)
+  {}
+
+  template <typename Range>
+  typename Range::index_type operator()(const Range& r) const
+  {
+    return thrust::count_if(thrust::seq, stencil + r.begin(), stencil + r.end(), pred);
+  }
+};
+
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Predicate>
+struct write_tile
+{
+  InputIterator1 first;
+  InputIterator2 stencil;
+  OutputIterator result;
+  Predicate pred;
+
+  write_tile(InputIterator1 first, InputIterator2 stencil, OutputIterator result, Predicate pred)
+      : first(first)
+      , stencil(stencil)
+      , result(result)
+      , pred(pred)
+  {}
+
+  template <typename Range, typename Size>
+  void operator()(const Range& r, Size offset, Size) const
+  {
+    thrust::copy_if(thrust::seq, first + r.begin(), first + r.end(), stencil + r.begin(), result + offset, pred);
+  }
+};
+
+} // namespace copy_if_detail
 
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -49,8 +99,27 @@ OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  using CountTile = copy_if_detail::count_tile<InputIterator2, Predicate>;
+  using WriteTile = copy_if_detail::write_tile<InputIterator1, InputIterator2, OutputIterator, Predicate>;
+
+  // every thread counts the elements of its tile which pass the predicate,
+  // then copies them to its slice of the result
+  Size num_selected = compact_tiles(
+    exec,
+    thrust::system::omp::detail::default_decomposition<Size>(exec, n),
+    CountTile(stencil, pred),
+    WriteTile(first, stencil, result, pred));
+
+  return result + num_selected;
 } // end copy_if()
 
 } // namespace detail
@@ -30,6 +30,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -42,6 +43,12 @@ namespace detail
 template <typename IndexType>
 thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n);
 
+// decomposes n elements into tiles for the threads requested by exec, each
+// at least exec's grain in size
+template <typename IndexType, typename DerivedPolicy>
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(execution_policy<DerivedPolicy>& exec, IndexType n);
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_config.h>
 
 // don't attempt to #include this file without omp support
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
@@ -59,6 +60,40 @@ thrust::system::detail::internal::uniform_decomposition<IndexType> default_decom
 #endif
 }
 
+template <typename IndexType, typename DerivedPolicy>
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(execution_policy<DerivedPolicy>& exec, IndexType n)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to OpenMP support in your compiler.                         X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<IndexType, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  parallel_config config = parallel_config_of(exec);
+
+  IndexType num_tiles   = config.num_threads > 0 ? config.num_threads : omp_get_num_procs();
+  IndexType granularity = config.grain > 0 ? static_cast<IndexType>(config.grain) : 1;
+
+  // with a load-balancing schedule, oversubscribe the threads so that those
+  // which finish early can pick up the remaining tiles
+  // XXX the oversubscription rate is a tuning opportunity
+  if (config.schedule != schedule_static)
+  {
+    num_tiles *= 4;
+  }
+
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, granularity, num_tiles);
+#else
+  (void) exec;
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
+#endif
+}
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
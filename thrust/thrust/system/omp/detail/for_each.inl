@@ -30,7 +30,8 @@
 #include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/parallel_config.h>
+#include <thrust/system/omp/detail/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -41,7 +42,8 @@ namespace detail
 {
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -65,12 +67,18 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIt
   using DifferenceType    = typename thrust::iterator_difference<RandomAccessIterator>::type;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (DifferenceType i = 0; i < signed_n; ++i)
-  {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
-  }
+  // under a load-balancing schedule, hand out the elements in chunks of the requested grain
+  parallel_config config = parallel_config_of(exec);
+  DifferenceType chunk   = config.grain > 0 ? static_cast<DifferenceType>(config.grain) : 1;
+
+  omp::detail::parallel_for(
+    exec,
+    signed_n,
+    [&](DifferenceType i) {
+      RandomAccessIterator temp = first + i;
+      wrapped_f(*temp);
+    },
+    chunk);
 
   return first + n;
 } // end for_each_n()
@@ -27,6 +27,9 @@
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/parallel_config.h>
+
+#include <cstddef>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,13 +39,83 @@ namespace omp
 namespace detail
 {
 
+template <typename Derived>
+struct execute_with_parallel_config_base : execution_policy<Derived>
+{
+private:
+  parallel_config config;
+
+public:
+  execute_with_parallel_config_base(const parallel_config& config_ = parallel_config())
+      : config(config_)
+  {}
+
+  // caps the number of threads of every parallel region the algorithm opens
+  Derived num_threads(int n) const
+  {
+    Derived result            = thrust::detail::derived_cast(*this);
+    result.config.num_threads = n;
+    return result;
+  }
+
+  // selects how the iterations of the algorithm's parallel loops are scheduled
+  Derived schedule(schedule_kind kind) const
+  {
+    Derived result         = thrust::detail::derived_cast(*this);
+    result.config.schedule = kind;
+    return result;
+  }
+
+  // the smallest number of elements worth handing to a thread
+  Derived grain(std::size_t n) const
+  {
+    Derived result      = thrust::detail::derived_cast(*this);
+    result.config.grain = n;
+    return result;
+  }
+
+private:
+  friend parallel_config get_parallel_config(const execute_with_parallel_config_base& exec)
+  {
+    return exec.config;
+  }
+};
+
+struct execute_with_parallel_config : execute_with_parallel_config_base<execute_with_parallel_config>
+{
+  using base_t = execute_with_parallel_config_base<execute_with_parallel_config>;
+
+  execute_with_parallel_config()
+      : base_t()
+  {}
+
+  execute_with_parallel_config(const parallel_config& config)
+      : base_t(config)
+  {}
+};
+
 struct par_t
     : thrust::system::omp::detail::execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<thrust::system::omp::detail::execution_policy>
+    , thrust::detail::allocator_aware_execution_policy<execute_with_parallel_config_base>
 {
   _CCCL_HOST_DEVICE constexpr par_t()
       : thrust::system::omp::detail::execution_policy<par_t>()
   {}
+
+  execute_with_parallel_config num_threads(int n) const
+  {
+    return execute_with_parallel_config().num_threads(n);
+  }
+
+  execute_with_parallel_config schedule(schedule_kind kind) const
+  {
+    return execute_with_parallel_config().schedule(kind);
+  }
+
+  execute_with_parallel_config grain(std::size_t n) const
+  {
+    return execute_with_parallel_config().grain(n);
+  }
 };
 
 } // namespace detail
@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// how the iterations of a parallel loop are handed to the threads of the team
+enum schedule_kind
+{
+  schedule_static,
+  schedule_dynamic,
+  schedule_guided
+};
+
+// the tuning parameters carried by an omp execution policy.
+// a num_threads of zero means the OpenMP runtime's default and a grain of zero
+// means one element
+struct parallel_config
+{
+  int num_threads;
+  schedule_kind schedule;
+  std::size_t grain;
+
+  parallel_config()
+      : num_threads(0)
+      , schedule(schedule_static)
+      , grain(0)
+  {}
+};
+
+// Fallback implementation of the customization point.
+template <typename Derived>
+parallel_config get_parallel_config(const execution_policy<Derived>&)
+{
+  return parallel_config();
+}
+
+// Entry point/interface.
+template <typename Derived>
+parallel_config parallel_config_of(execution_policy<Derived>& exec)
+{
+  return get_parallel_config(thrust::detail::derived_cast(exec));
+}
+
+} // namespace detail
+
+// alias schedule_kind here
+using thrust::system::omp::detail::schedule_dynamic;
+using thrust::system::omp::detail::schedule_guided;
+using thrust::system::omp::detail::schedule_kind;
+using thrust::system::omp::detail::schedule_static;
+
+} // namespace omp
+} // namespace system
+
+// alias items at top-level
+namespace omp
+{
+
+using thrust::system::omp::schedule_dynamic;
+using thrust::system::omp::schedule_guided;
+using thrust::system::omp::schedule_kind;
+using thrust::system::omp::schedule_static;
+
+} // namespace omp
+THRUST_NAMESPACE_END
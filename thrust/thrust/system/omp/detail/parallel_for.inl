@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/system/omp/detail/parallel_config.h>
+#include <thrust/system/omp/detail/parallel_for.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename Size, typename Function>
+void parallel_for(execution_policy<DerivedPolicy>& exec, Size n, Function f, Size chunk)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<Function, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  parallel_config config = parallel_config_of(exec);
+
+  int num_threads = config.num_threads > 0 ? config.num_threads : omp_get_max_threads();
+
+  switch (config.schedule)
+  {
+    case schedule_dynamic:
+      THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(dynamic, chunk))
+      for (Size i = 0; i < n; ++i)
+      {
+        f(i);
+      }
+      break;
+
+    case schedule_guided:
+      THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(guided, chunk))
+      for (Size i = 0; i < n; ++i)
+      {
+        f(i);
+      }
+      break;
+
+    default:
+      THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(static))
+      for (Size i = 0; i < n; ++i)
+      {
+        f(i);
+      }
+      break;
+  }
+#else
+  (void) exec;
+  (void) n;
+  (void) f;
+  (void) chunk;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
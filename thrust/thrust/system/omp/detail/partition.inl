@@ -29,7 +29,13 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/partition.h>
+#include <thrust/detail/seq.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/partition.h>
+#include <thrust/system/omp/detail/compaction.h>
+#include <thrust/system/omp/detail/copy_if.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/partition.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -39,13 +45,171 @@ namespace omp
 {
 namespace detail
 {
+namespace partition_detail
+{
+
+// writes the true elements of a tile to out_true + offset and its false
+// elements to out_false + (number of false elements in earlier tiles)
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Predicate>
+struct partition_copy_tile
+{
+  InputIterator1 first;
+  InputIterator2 stencil;
+  OutputIterator1 out_true;
+  OutputIterator2 out_false;
+  Predicate pred;
+
+  partition_copy_tile(
+    InputIterator1 first, InputIterator2 stencil, OutputIterator1 out_true, OutputIterator2 out_false, Predicate pred)
+      : first(first)
+      , stencil(stencil)
+      , out_true(out_true)
+      , out_false(out_false)
+      , pred(pred)
+  {}
+
+  template <typename Range, typename Size>
+  void operator()(const Range& r, Size offset, Size) const
+  {
+    thrust::stable_partition_copy(
+      thrust::seq,
+      first + r.begin(),
+      first + r.end(),
+      stencil + r.begin(),
+      out_true + offset,
+      out_false + (r.begin() - offset),
+      pred);
+  }
+};
+
+// stably partitions a tile in place, returning how many of its elements are true
+template <typename ForwardIterator, typename Predicate>
+struct partition_tile
+{
+  ForwardIterator first;
+  Predicate pred;
+
+  partition_tile(ForwardIterator first, Predicate pred)
+      : first(first)
+      , pred(pred)
+  {}
+
+  template <typename Range>
+  typename Range::index_type operator()(const Range& r) const
+  {
+    return thrust::stable_partition(thrust::seq, first + r.begin(), first + r.end(), pred) - (first + r.begin());
+  }
+};
+
+// stably partitions a tile in place by its stencil, returning how many of its elements are true
+template <typename ForwardIterator, typename InputIterator, typename Predicate>
+struct partition_stencil_tile
+{
+  ForwardIterator first;
+  InputIterator stencil;
+  Predicate pred;
+
+  partition_stencil_tile(ForwardIterator first, InputIterator stencil, Predicate pred)
+      : first(first)
+      , stencil(stencil)
+      , pred(pred)
+  {}
+
+  template <typename Range>
+  typename Range::index_type operator()(const Range& r) const
+  {
+    return thrust::stable_partition(thrust::seq, first + r.begin(), first + r.end(), stencil + r.begin(), pred)
+         - (first + r.begin());
+  }
+};
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Predicate>
+thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator1 out_true,
+  OutputIterator2 out_false,
+  Predicate pred)
+{
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return thrust::make_pair(out_true, out_false);
+  }
+
+  using CountTile = copy_if_detail::count_tile<InputIterator2, Predicate>;
+  using WriteTile = partition_copy_tile<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2, Predicate>;
+
+  // every thread counts the true elements of its tile, then partitions
+  // its tile into its slices of both outputs
+  Size num_true = compact_tiles(
+    exec,
+    thrust::system::omp::detail::default_decomposition<Size>(exec, n),
+    CountTile(stencil, pred),
+    WriteTile(first, stencil, out_true, out_false, pred));
+
+  return thrust::make_pair(out_true + num_true, out_false + (n - num_true));
+}
+
+// The sequential stable_partition of a tile allocates a copy of it, so tiles
+// are kept small: the copies alive at any one time then take space in
+// proportion to the number of threads rather than to n. The extra rounds of
+// gathering the tiles are the price of not copying the input.
+// XXX the tile size is a tuning opportunity
+static const int max_partition_tile_size = 1 << 16;
+
+template <typename DerivedPolicy, typename Size>
+thrust::system::detail::internal::uniform_decomposition<Size>
+partition_decomposition(execution_policy<DerivedPolicy>& exec, Size n)
+{
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition<Size>(exec, n);
+
+  if (decomp[0].size() > max_partition_tile_size)
+  {
+    decomp = thrust::system::detail::internal::uniform_decomposition<Size>(n, max_partition_tile_size, n);
+  }
+
+  return decomp;
+}
+
+} // namespace partition_detail
 
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
+  using Size = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return first;
+  }
+
+  using PartitionTile = partition_detail::partition_tile<ForwardIterator, Predicate>;
+
+  // every thread stably partitions its own tile in place, then the true
+  // elements are gathered at the front and the false ones behind them
+  Size num_true = partition_tiles_in_place(
+    exec, first, partition_detail::partition_decomposition(exec, n), PartitionTile(first, pred));
+
+  return first + num_true;
 } // end stable_partition()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
@@ -56,8 +220,23 @@ ForwardIterator stable_partition(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  using Size = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return first;
+  }
+
+  using PartitionTile = partition_detail::partition_stencil_tile<ForwardIterator, InputIterator, Predicate>;
+
+  // every thread stably partitions its own tile in place, then the true
+  // elements are gathered at the front and the false ones behind them
+  Size num_true = partition_tiles_in_place(
+    exec, first, partition_detail::partition_decomposition(exec, n), PartitionTile(first, stencil, pred));
+
+  return first + num_true;
 } // end stable_partition()
 
 template <typename DerivedPolicy,
@@ -73,8 +252,7 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  return partition_detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
@@ -92,8 +270,7 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  return partition_detail::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 } // end namespace detail
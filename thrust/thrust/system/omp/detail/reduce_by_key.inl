@@ -25,10 +25,20 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
-#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/omp/detail/compaction.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_for.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 
+#include <cstdint>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -36,6 +46,99 @@ namespace omp
 {
 namespace detail
 {
+namespace reduce_by_key_detail
+{
+
+// reduces the segments which begin in a tile and writes them to the output
+// starting at offset. the elements at the front of the tile which continue a
+// segment begun in an earlier tile are reduced to *carry instead, and when the
+// last segment runs past the end of the tile only its key is written and its
+// partial sum goes to *tail, to be completed with the following carries later
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+struct reduce_tile
+{
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  InputIterator1 keys_first;
+  Size n;
+  InputIterator2 values_first;
+  OutputIterator1 keys_output;
+  OutputIterator2 values_output;
+  BinaryPredicate binary_pred;
+  BinaryFunction binary_op;
+
+  reduce_tile(InputIterator1 keys_first,
+              Size n,
+              InputIterator2 values_first,
+              OutputIterator1 keys_output,
+              OutputIterator2 values_output,
+              BinaryPredicate binary_pred,
+              BinaryFunction binary_op)
+      : keys_first(keys_first)
+      , n(n)
+      , values_first(values_first)
+      , keys_output(keys_output)
+      , values_output(values_output)
+      , binary_pred(binary_pred)
+      , binary_op(binary_op)
+  {}
+
+  template <typename Range, typename ValueType>
+  void operator()(const Range& r, Size offset, ValueType* carry, ValueType* tail) const
+  {
+    thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_binary_pred(binary_pred);
+    thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op(binary_op);
+
+    Size i   = r.begin();
+    Size end = r.end();
+
+    if (i != 0 && wrapped_binary_pred(keys_first[i - 1], keys_first[i]))
+    {
+      ValueType sum = values_first[i];
+
+      for (++i; i != end && wrapped_binary_pred(keys_first[i - 1], keys_first[i]); ++i)
+      {
+        sum = wrapped_binary_op(sum, values_first[i]);
+      }
+
+      *carry = sum;
+    }
+
+    OutputIterator1 keys_result   = keys_output + offset;
+    OutputIterator2 values_result = values_output + offset;
+
+    while (i != end)
+    {
+      *keys_result = keys_first[i];
+
+      ValueType sum = values_first[i];
+
+      for (++i; i != end && wrapped_binary_pred(keys_first[i - 1], keys_first[i]); ++i)
+      {
+        sum = wrapped_binary_op(sum, values_first[i]);
+      }
+
+      if (i == end && end != n && wrapped_binary_pred(keys_first[end - 1], keys_first[end]))
+      {
+        *tail = sum;
+      }
+      else
+      {
+        *values_result = sum;
+      }
+
+      ++keys_result;
+      ++values_result;
+    }
+  }
+};
+
+} // namespace reduce_by_key_detail
 
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -54,9 +157,113 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator2>::type;
+
+  Size n = thrust::distance(keys_first, keys_last);
+
+  if (n == 0)
+  {
+    return thrust::make_pair(keys_output, values_output);
+  }
+
+  Size num_segments = 0;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using CountTile  = count_run_heads<InputIterator1, BinaryPredicate>;
+  using ReduceTile = reduce_by_key_detail::
+    reduce_tile<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2, BinaryPredicate, BinaryFunction>;
+
+  using index_type = std::intptr_t;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition<Size>(exec, n);
+
+  index_type nseg = static_cast<index_type>(decomp.size());
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, nseg + 1);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, nseg);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> tails(exec, nseg);
+
+  Size* raw_offsets      = thrust::raw_pointer_cast(offsets.data());
+  ValueType* raw_carries = thrust::raw_pointer_cast(carries.data());
+  ValueType* raw_tails   = thrust::raw_pointer_cast(tails.data());
+
+  CountTile count(keys_first, binary_pred);
+  ReduceTile reduce(keys_first, n, values_first, keys_output, values_output, binary_pred, binary_op);
+
+  // every thread counts the heads of the segments in its own tile
+  omp::detail::parallel_for(exec, nseg, [&](index_type i) {
+    raw_offsets[i + 1] = count(decomp[i]);
+  });
+
+  // scan the counts to find where each tile's segments go
+  raw_offsets[0] = 0;
+
+  for (index_type i = 0; i < nseg; i++)
+  {
+    raw_offsets[i + 1] += raw_offsets[i];
+  }
+
+  // every thread reduces the segments which begin in its own tile
+  omp::detail::parallel_for(exec, nseg, [&](index_type i) {
+    reduce(decomp[i], raw_offsets[i], raw_carries + i, raw_tails + i);
+  });
+
+  // complete the segments which cross tile boundaries: the partial sum of the
+  // last segment of a tile is followed by the carries of the tiles after it,
+  // up to and including the first one in which a new segment begins
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_binary_pred(binary_pred);
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op(binary_op);
+
+  for (index_type i = 0; i + 1 < nseg; i++)
+  {
+    Size next = decomp[i + 1].begin();
+
+    if (raw_offsets[i + 1] == raw_offsets[i] || !wrapped_binary_pred(keys_first[next - 1], keys_first[next]))
+    {
+      // no segment begins in this tile, or its last one ends with it
+      continue;
+    }
+
+    ValueType sum = raw_tails[i];
+
+    for (index_type j = i + 1; j < nseg; j++)
+    {
+      Size begin = decomp[j].begin();
+
+      if (!wrapped_binary_pred(keys_first[begin - 1], keys_first[begin]))
+      {
+        break;
+      }
+
+      sum = wrapped_binary_op(sum, raw_carries[j]);
+
+      if (raw_offsets[j + 1] != raw_offsets[j])
+      {
+        break;
+      }
+    }
+
+    values_output[raw_offsets[i + 1] - 1] = sum;
+  }
+
+  num_segments = raw_offsets[nseg];
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return thrust::make_pair(keys_output + num_segments, values_output + num_segments);
 } // end reduce_by_key()
 
 } // namespace detail
@@ -28,7 +28,8 @@
 #include <thrust/detail/function.h>
 #include <thrust/detail/static_assert.h> // for depend_on_instantiation
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/detail/sequential/reduce.h>
+#include <thrust/system/omp/detail/parallel_for.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
 
 #include <cstdint>
@@ -47,7 +48,7 @@ template <typename DerivedPolicy,
           typename BinaryFunction,
           typename Decomposition>
 void reduce_intervals(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator input,
   OutputIterator output,
   BinaryFunction binary_op,
@@ -66,16 +67,15 @@ void reduce_intervals(
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   using OutputType = typename thrust::iterator_value<OutputIterator>::type;
 
-  // wrap binary_op
-  thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op(binary_op);
+  // reduce each interval in lanes when the sequential reduce would
+  using use_reduce_lanes =
+    thrust::system::detail::sequential::reduce_detail::use_reduce_lanes<InputIterator, OutputType, BinaryFunction>;
 
   using index_type = std::intptr_t;
 
   index_type n = static_cast<index_type>(decomp.size());
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (index_type i = 0; i < n; i++)
-  {
+  omp::detail::parallel_for(exec, n, [&](index_type i) {
     InputIterator begin = input + decomp[i].begin();
     InputIterator end   = input + decomp[i].end();
 
@@ -85,16 +85,12 @@ void reduce_intervals(
 
       ++begin;
 
-      while (begin != end)
-      {
-        sum = wrapped_binary_op(sum, *begin);
-        ++begin;
-      }
+      sum = thrust::system::detail::sequential::reduce_detail::reduce(begin, end, sum, binary_op, use_reduce_lanes());
 
       OutputIterator tmp = output + i;
       *tmp               = sum;
     }
-  }
+  });
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
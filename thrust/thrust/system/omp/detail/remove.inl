@@ -25,7 +25,13 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/remove.h>
 #include <thrust/system/detail/generic/remove.h>
+#include <thrust/system/omp/detail/compaction.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/remove.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -35,13 +41,73 @@ namespace omp
 {
 namespace detail
 {
+namespace remove_detail
+{
+
+// removes the elements of a tile which satisfy pred, returning how many are kept
+template <typename ForwardIterator, typename Predicate>
+struct remove_tile
+{
+  ForwardIterator first;
+  Predicate pred;
+
+  remove_tile(ForwardIterator first, Predicate pred)
+      : first(first)
+      , pred(pred)
+  {}
+
+  template <typename Range>
+  typename Range::index_type operator()(const Range& r) const
+  {
+    return thrust::remove_if(thrust::seq, first + r.begin(), first + r.end(), pred) - (first + r.begin());
+  }
+};
+
+// removes the elements of a tile whose stencil satisfies pred, returning how many are kept
+template <typename ForwardIterator, typename InputIterator, typename Predicate>
+struct remove_stencil_tile
+{
+  ForwardIterator first;
+  InputIterator stencil;
+  Predicate pred;
+
+  remove_stencil_tile(ForwardIterator first, InputIterator stencil, Predicate pred)
+      : first(first)
+      , stencil(stencil)
+      , pred(pred)
+  {}
+
+  template <typename Range>
+  typename Range::index_type operator()(const Range& r) const
+  {
+    return thrust::remove_if(thrust::seq, first + r.begin(), first + r.end(), stencil + r.begin(), pred)
+         - (first + r.begin());
+  }
+};
+
+} // namespace remove_detail
 
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 remove_if(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, pred);
+  using Size = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return first;
+  }
+
+  using RemoveTile = remove_detail::remove_tile<ForwardIterator, Predicate>;
+
+  // every thread removes elements from its own tile in place, then the
+  // remaining elements are gathered at the front
+  Size num_kept = compact_tiles_in_place(
+    exec, first, thrust::system::omp::detail::default_decomposition<Size>(exec, n), RemoveTile(first, pred));
+
+  return first + num_kept;
 }
 
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
@@ -52,8 +118,23 @@ ForwardIterator remove_if(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, stencil, pred);
+  using Size = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return first;
+  }
+
+  using RemoveTile = remove_detail::remove_stencil_tile<ForwardIterator, InputIterator, Predicate>;
+
+  // every thread removes elements from its own tile in place, then the
+  // remaining elements are gathered at the front
+  Size num_kept = compact_tiles_in_place(
+    exec, first, thrust::system::omp::detail::default_decomposition<Size>(exec, n), RemoveTile(first, stencil, pred));
+
+  return first + num_kept;
 }
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Predicate>
@@ -78,6 +159,7 @@ OutputIterator remove_copy_if(
   Predicate pred)
 {
   // omp prefers generic::remove_copy_if to cpp::remove_copy_if
+  // it is implemented with omp::copy_if
   return thrust::system::detail::generic::remove_copy_if(exec, first, last, stencil, result, pred);
 }
 
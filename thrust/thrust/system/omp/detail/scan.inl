@@ -0,0 +1,264 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_for.h>
+#include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/omp/detail/scan.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_detail
+{
+
+// The scans below are organized as three passes over a uniform decomposition
+// of the input into one tile per processor:
+//
+//   1. reduce each tile to a partial sum (reduce_intervals),
+//   2. serially scan the (few) tile partials to find each tile's carry-in,
+//   3. rescan each tile in parallel, seeded with its carry-in.
+//
+// Each element is read twice and written once. Each tile only writes the output
+// positions of the elements it reads, so in-place scans are safe.
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinaryFunction,
+          typename Decomposition,
+          typename RandomAccessIterator>
+void inclusive_downsweep(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  OutputIterator result,
+  BinaryFunction binary_op,
+  Decomposition decomp,
+  RandomAccessIterator carries)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using ValueType = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  using index_type = std::intptr_t;
+
+  index_type n = static_cast<index_type>(decomp.size());
+
+  omp::detail::parallel_for(exec, n, [&](index_type i) {
+    InputIterator begin = first + decomp[i].begin();
+    InputIterator end   = first + decomp[i].end();
+    OutputIterator out  = result + decomp[i].begin();
+
+    if (begin != end)
+    {
+      ValueType sum = *begin;
+
+      // the first tile has no carry-in
+      if (i > 0)
+      {
+        ValueType carry = carries[i - 1];
+        sum             = binary_op(carry, sum);
+      }
+
+      *out = sum;
+
+      for (++begin, ++out; begin != end; ++begin, ++out)
+      {
+        *out = sum = binary_op(sum, *begin);
+      }
+    }
+  });
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinaryFunction,
+          typename Decomposition,
+          typename RandomAccessIterator>
+void exclusive_downsweep(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  OutputIterator result,
+  BinaryFunction binary_op,
+  Decomposition decomp,
+  RandomAccessIterator carries)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using ValueType = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  using index_type = std::intptr_t;
+
+  index_type n = static_cast<index_type>(decomp.size());
+
+  omp::detail::parallel_for(exec, n, [&](index_type i) {
+    InputIterator begin = first + decomp[i].begin();
+    InputIterator end   = first + decomp[i].end();
+    OutputIterator out  = result + decomp[i].begin();
+
+    ValueType sum = carries[i];
+
+    for (; begin != end; ++begin, ++out)
+    {
+      ValueType tmp = *begin; // temporary value allows in-situ scan
+      *out          = sum;
+      sum           = binary_op(sum, tmp);
+    }
+  });
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // end namespace scan_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator>::type;
+
+  using difference_type = typename thrust::iterator_difference<InputIterator>::type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op(binary_op);
+
+  // reduce each tile
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+  thrust::system::omp::detail::reduce_intervals(exec, first, carries.begin(), binary_op, decomp);
+
+  // scan the tile partials in place: carries[i] becomes the carry-in of tile i + 1
+  ValueType carry = carries[0];
+
+  for (difference_type i = 1; i < decomp.size(); ++i)
+  {
+    ValueType partial = carries[i];
+    carries[i]        = carry = wrapped_binary_op(carry, partial);
+  }
+
+  // scan each tile, seeded with the partials of the tiles before it
+  scan_detail::inclusive_downsweep(exec, first, result, wrapped_binary_op, decomp, carries.begin());
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator exclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the initial value type per https://wg21.link/P0571
+  using ValueType = InitialValueType;
+
+  using difference_type = typename thrust::iterator_difference<InputIterator>::type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  // reduce each tile, leaving room for init in front
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size() + 1);
+  carries[0] = init;
+  thrust::system::omp::detail::reduce_intervals(exec, first, carries.begin() + 1, binary_op, decomp);
+
+  // scan the tile partials in place: carries[i] becomes the carry-in of tile i
+  ValueType carry = init;
+
+  for (difference_type i = 1; i < decomp.size(); ++i)
+  {
+    ValueType partial = carries[i];
+    carries[i]        = carry = binary_op(carry, partial);
+  }
+
+  // scan each tile, seeded with init and the partials of the tiles before it
+  scan_detail::exclusive_downsweep(exec, first, result, binary_op, decomp, carries.begin());
+
+  return result + n;
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
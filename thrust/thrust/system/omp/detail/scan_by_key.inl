@@ -0,0 +1,412 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_for.h>
+#include <thrust/system/omp/detail/scan_by_key.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_by_key_detail
+{
+
+// Like scan, the segmented scans are organized as three passes over one tile per
+// processor. The first pass records, for every tile, the reduction of its last
+// segment, whether a segment starts inside of it and whether its first element
+// continues the previous tile's last segment. The second pass serially turns
+// those into carry-ins, and the third rescans each tile, seeding the elements
+// which continue the previous tile's last segment with its carry-in.
+//
+// Only the first pass looks at keys outside of a tile, so the output may alias
+// either the keys or the values.
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename Decomposition,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3>
+void reduce_tail_segments(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys,
+  InputIterator2 values,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  Decomposition decomp,
+  RandomAccessIterator1 partials,
+  RandomAccessIterator2 heads,
+  RandomAccessIterator3 continued)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using KeyType   = typename thrust::iterator_traits<InputIterator1>::value_type;
+  using ValueType = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  using index_type = std::intptr_t;
+
+  index_type n = static_cast<index_type>(decomp.size());
+
+  omp::detail::parallel_for(exec, n, [&](index_type i) {
+    InputIterator1 key_iter   = keys + decomp[i].begin();
+    InputIterator1 key_end    = keys + decomp[i].end();
+    InputIterator2 value_iter = values + decomp[i].begin();
+
+    if (key_iter != key_end)
+    {
+      KeyType prev_key = *key_iter;
+      ValueType sum    = *value_iter;
+      bool head        = true;
+
+      if (i > 0)
+      {
+        KeyType last_key = *(key_iter - 1);
+        head             = !binary_pred(last_key, prev_key);
+      }
+
+      continued[i] = !head;
+
+      for (++key_iter, ++value_iter; key_iter != key_end; ++key_iter, ++value_iter)
+      {
+        KeyType key = *key_iter;
+
+        if (binary_pred(prev_key, key))
+        {
+          ValueType value = *value_iter;
+          sum             = binary_op(sum, value);
+        }
+        else
+        {
+          sum  = *value_iter;
+          head = true;
+        }
+
+        prev_key = key;
+      }
+
+      partials[i] = sum;
+      heads[i]    = head;
+    }
+  });
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+// replaces partials[i] with the carry-in of tile i; partials[0] is left as is
+template <typename Size, typename BinaryFunction, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void scan_tail_segments(
+  Size num_tiles, BinaryFunction binary_op, RandomAccessIterator1 partials, RandomAccessIterator2 heads)
+{
+  using ValueType = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  ValueType carry = partials[0];
+
+  for (Size i = 1; i < num_tiles; ++i)
+  {
+    ValueType tmp = partials[i];
+    partials[i]   = carry;
+    carry         = heads[i] ? tmp : ValueType(binary_op(carry, tmp));
+  }
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename Decomposition,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+void inclusive_downsweep(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys,
+  InputIterator2 values,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  Decomposition decomp,
+  RandomAccessIterator1 carries,
+  RandomAccessIterator2 continued)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using KeyType   = typename thrust::iterator_traits<InputIterator1>::value_type;
+  using ValueType = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  using index_type = std::intptr_t;
+
+  index_type n = static_cast<index_type>(decomp.size());
+
+  omp::detail::parallel_for(exec, n, [&](index_type i) {
+    InputIterator1 key_iter   = keys + decomp[i].begin();
+    InputIterator1 key_end    = keys + decomp[i].end();
+    InputIterator2 value_iter = values + decomp[i].begin();
+    OutputIterator out        = result + decomp[i].begin();
+
+    if (key_iter != key_end)
+    {
+      KeyType prev_key = *key_iter;
+
+      ValueType sum = *value_iter;
+
+      // continue the previous tile's last segment if our first key belongs to it
+      if (continued[i])
+      {
+        ValueType carry = carries[i];
+        sum             = binary_op(carry, sum);
+      }
+
+      *out = sum;
+
+      for (++key_iter, ++value_iter, ++out; key_iter != key_end; ++key_iter, ++value_iter, ++out)
+      {
+        KeyType key = *key_iter;
+
+        if (binary_pred(prev_key, key))
+        {
+          ValueType value = *value_iter;
+          *out = sum = binary_op(sum, value);
+        }
+        else
+        {
+          *out = sum = *value_iter;
+        }
+
+        prev_key = key;
+      }
+    }
+  });
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename Decomposition,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+void exclusive_downsweep(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys,
+  InputIterator2 values,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  Decomposition decomp,
+  RandomAccessIterator1 carries,
+  RandomAccessIterator2 continued)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using KeyType   = typename thrust::iterator_traits<InputIterator1>::value_type;
+  using ValueType = T;
+
+  using index_type = std::intptr_t;
+
+  index_type n = static_cast<index_type>(decomp.size());
+
+  omp::detail::parallel_for(exec, n, [&](index_type i) {
+    InputIterator1 key_iter   = keys + decomp[i].begin();
+    InputIterator1 key_end    = keys + decomp[i].end();
+    InputIterator2 value_iter = values + decomp[i].begin();
+    OutputIterator out        = result + decomp[i].begin();
+
+    if (key_iter != key_end)
+    {
+      KeyType prev_key = *key_iter;
+
+      ValueType next = init;
+
+      // continue the previous tile's last segment if our first key belongs to it
+      if (continued[i])
+      {
+        ValueType carry = carries[i];
+        next            = binary_op(next, carry);
+      }
+
+      // use temp to permit in-place scans
+      ValueType temp_value = *value_iter;
+
+      *out = next;
+      next = binary_op(next, temp_value);
+
+      for (++key_iter, ++value_iter, ++out; key_iter != key_end; ++key_iter, ++value_iter, ++out)
+      {
+        KeyType key = *key_iter;
+
+        temp_value = *value_iter;
+
+        if (!binary_pred(prev_key, key))
+        {
+          next = init; // reset sum
+        }
+
+        *out = next;
+        next = binary_op(next, temp_value);
+
+        prev_key = key;
+      }
+    }
+  });
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // end namespace scan_by_key_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using ValueType = typename thrust::iterator_traits<InputIterator2>::value_type;
+
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const difference_type n = thrust::distance(first1, last1);
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op(binary_op);
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+  thrust::detail::temporary_array<bool, DerivedPolicy> heads(exec, decomp.size());
+  thrust::detail::temporary_array<bool, DerivedPolicy> continued(exec, decomp.size());
+
+  scan_by_key_detail::reduce_tail_segments(
+    exec, first1, first2, binary_pred, wrapped_binary_op, decomp, carries.begin(), heads.begin(), continued.begin());
+
+  scan_by_key_detail::scan_tail_segments(decomp.size(), wrapped_binary_op, carries.begin(), heads.begin());
+
+  scan_by_key_detail::inclusive_downsweep(
+    exec, first1, first2, result, binary_pred, wrapped_binary_op, decomp, carries.begin(), continued.begin());
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using ValueType = T;
+
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const difference_type n = thrust::distance(first1, last1);
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+  thrust::detail::temporary_array<bool, DerivedPolicy> heads(exec, decomp.size());
+  thrust::detail::temporary_array<bool, DerivedPolicy> continued(exec, decomp.size());
+
+  scan_by_key_detail::reduce_tail_segments(
+    exec, first1, first2, binary_pred, binary_op, decomp, carries.begin(), heads.begin(), continued.begin());
+
+  scan_by_key_detail::scan_tail_segments(decomp.size(), binary_op, carries.begin(), heads.begin());
+
+  scan_by_key_detail::exclusive_downsweep(
+    exec, first1, first2, result, init, binary_pred, binary_op, decomp, carries.begin(), continued.begin());
+
+  return result + n;
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -26,18 +26,31 @@
 #  pragma system_header
 #endif // no system header
 
-// don't attempt to #include this file without omp support
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-#  include <omp.h>
-#endif // omp support
-
+#include <thrust/copy.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/detail/sequential/pdqsort.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_config.h>
+#include <thrust/system/omp/detail/parallel_for.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -58,10 +71,12 @@ void inplace_merge(execution_policy<DerivedPolicy>& exec,
 {
   using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, first, last);
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+  typename thrust::detail::temporary_array<value_type, DerivedPolicy>::iterator temp_middle =
+    temp.begin() + (middle - first);
+
+  thrust::merge(exec, temp.begin(), temp_middle, temp_middle, temp.end(), first, comp);
 }
 
 template <typename DerivedPolicy,
@@ -79,97 +94,472 @@ void inplace_merge_by_key(
   using value_type1 = typename thrust::iterator_value<RandomAccessIterator1>::type;
   using value_type2 = typename thrust::iterator_value<RandomAccessIterator2>::type;
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
+  RandomAccessIterator2 last2 = first2 + (last1 - first1);
+
+  thrust::detail::temporary_array<value_type1, DerivedPolicy> temp1(exec, first1, last1);
+  thrust::detail::temporary_array<value_type2, DerivedPolicy> temp2(exec, first2, last2);
 
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+  typename thrust::detail::temporary_array<value_type1, DerivedPolicy>::iterator temp1_middle =
+    temp1.begin() + (middle1 - first1);
+  typename thrust::detail::temporary_array<value_type2, DerivedPolicy>::iterator temp2_middle =
+    temp2.begin() + (middle1 - first1);
 
   thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
+    exec, temp1.begin(), temp1_middle, temp1_middle, temp1.end(), temp2.begin(), temp2_middle, first1, first2, comp);
 }
 
-} // namespace sort_detail
+////////////////
+// Radix Sort //
+////////////////
 
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void stable_sort(
-  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+// Moves the keys (and values) of [keys_src, keys_src + n) into the order of
+// one digit. Returns false, without moving anything, if all keys share that digit.
+template <bool HasValues,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename Digit>
+bool radix_pass(execution_policy<DerivedPolicy>& exec,
+                RandomAccessIterator1 keys_src,
+                RandomAccessIterator2 vals_src,
+                RandomAccessIterator3 keys_dst,
+                RandomAccessIterator4 vals_dst,
+                const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+                Digit digit,
+                std::size_t* histograms)
 {
-  // we're attempting to launch an omp kernel, assert we're compiling with omp support
-  // ========================================================================
-  // X Note to the user: If you've found this line due to a compiler error, X
-  // X you need to enable OpenMP support in your compiler.                  X
-  // ========================================================================
-  THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
-                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
-    "OpenMP compiler support is not enabled");
+  using key_type   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using index_type = std::intptr_t;
 
-  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const unsigned int num_buckets = Digit::num_buckets;
+
+  index_type nseg = static_cast<index_type>(decomp.size());
+
+  // every thread counts the digits of its own tile
+  omp::detail::parallel_for(exec, nseg, [&](index_type i) {
+    std::size_t* histogram = histograms + i * num_buckets;
+
+    for (unsigned int d = 0; d < num_buckets; d++)
+    {
+      histogram[d] = 0;
+    }
+
+    for (Size j = decomp[i].begin(); j < decomp[i].end(); j++)
+    {
+      histogram[digit(keys_src[j])]++;
+    }
+  });
+
+  if (!thrust::system::detail::internal::radix_scan_histograms<Digit::num_buckets>(
+        histograms, nseg, static_cast<std::size_t>(decomp[nseg - 1].end())))
+  {
+    return false;
+  }
+
+  // every thread scatters its own tile into the slots reserved for it
+  omp::detail::parallel_for(exec, nseg, [&](index_type i) {
+    std::size_t* offsets = histograms + i * num_buckets;
+
+    for (Size j = decomp[i].begin(); j < decomp[i].end(); j++)
+    {
+      key_type key = keys_src[j];
+
+      std::size_t k = offsets[digit(key)]++;
+
+      keys_dst[k] = key;
+
+      if (HasValues)
+      {
+        vals_dst[k] = vals_src[j];
+      }
+    }
+  });
+
+  return true;
+}
+
+// LSD radix sort of [keys1, keys1 + n) with 8-bit digits. Each pass counts
+// digits per tile, scans the tile histograms, and scatters every tile in
+// parallel, ping-ponging between (keys1, vals1) and (keys2, vals2).
+template <bool HasValues,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename StrictWeakOrdering>
+void radix_sort(execution_policy<DerivedPolicy>& exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                RandomAccessIterator3 vals1,
+                RandomAccessIterator4 vals2,
+                const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+                StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using Digit    = thrust::system::detail::internal::radix_digit<key_type, StrictWeakOrdering>;
+
+  const Size n = decomp[decomp.size() - 1].end();
+
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> histograms(exec, decomp.size() * Digit::num_buckets);
+
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
+
+  for (unsigned int pass = 0; pass < Digit::num_passes; pass++)
+  {
+    std::size_t* raw_histograms = thrust::raw_pointer_cast(histograms.data());
+
+    Digit digit(pass, comp);
+
+    bool moved = flip ? radix_pass<HasValues>(exec, keys2, vals2, keys1, vals1, decomp, digit, raw_histograms)
+                      : radix_pass<HasValues>(exec, keys1, vals1, keys2, vals2, decomp, digit, raw_histograms);
+
+    if (moved)
+    {
+      flip = !flip;
+    }
+  }
+
+  // ensure final values are in (keys1,vals1)
+  if (flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
+
+    if (HasValues)
+    {
+      thrust::copy(exec, vals2, vals2 + n, vals1);
+    }
+  }
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
+{
   using IndexType = typename thrust::iterator_difference<RandomAccessIterator>::type;
+  using key_type  = typename thrust::iterator_value<RandomAccessIterator>::type;
 
-  if (first == last)
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp =
+    thrust::system::omp::detail::default_decomposition<IndexType>(exec, last - first);
+
+  // the sequential sorts dispatch their nested algorithms through the policy
+  // they are given, so they must not be handed the omp policy
+  if (decomp.size() < 2)
   {
+    thrust::stable_sort(thrust::seq, first, last, comp);
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, last - first);
+
+  radix_sort<false>(exec, first, temp.begin(), static_cast<int*>(0), static_cast<int*>(0), decomp, comp);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  using IndexType  = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using key_type   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using value_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp =
+    thrust::system::omp::detail::default_decomposition<IndexType>(exec, keys_last - keys_first);
+
+  if (decomp.size() < 2)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> keys_temp(exec, keys_last - keys_first);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> values_temp(exec, keys_last - keys_first);
+
+  radix_sort<true>(exec, keys_first, keys_temp.begin(), values_first, values_temp.begin(), decomp, comp);
+}
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+////////////////
+// Merge Sort //
+////////////////
 
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
+{
+  using IndexType = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp =
+    thrust::system::omp::detail::default_decomposition<IndexType>(exec, last - first);
+
+  using index_type = std::intptr_t;
+
+  index_type nseg = static_cast<index_type>(decomp.size());
+
+  // every thread sorts its own tile
+  omp::detail::parallel_for(exec, nseg, [&](index_type i) {
+    thrust::stable_sort(thrust::seq, first + decomp[i].begin(), first + decomp[i].end(), comp);
+  });
+
+  // merge neighboring runs of h sorted tiles pairwise until a single run is left.
+  // each merge is itself spread over all threads, so the last passes don't leave
+  // most of them waiting at a barrier
+  for (index_type h = 1; h < nseg; h *= 2)
+  {
+    for (index_type a = 0; a + h < nseg; a += 2 * h)
     {
-      thrust::stable_sort(thrust::seq, first + decomp[p_i].begin(), first + decomp[p_i].end(), comp);
+      index_type c = (a + 2 * h < nseg) ? a + 2 * h - 1 : nseg - 1;
+
+      inplace_merge(exec, first + decomp[a].begin(), first + decomp[a + h].begin(), first + decomp[c].end(), comp);
     }
+  }
+}
 
-    THRUST_PRAGMA_OMP(barrier)
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
+{
+  using IndexType = typename thrust::iterator_difference<RandomAccessIterator1>::type;
 
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp =
+    thrust::system::omp::detail::default_decomposition<IndexType>(exec, keys_last - keys_first);
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+  using index_type = std::intptr_t;
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+  index_type nseg = static_cast<index_type>(decomp.size());
 
-    while (nseg > 1)
-    {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
+  // every thread sorts its own tile
+  omp::detail::parallel_for(exec, nseg, [&](index_type i) {
+    thrust::stable_sort_by_key(
+      thrust::seq,
+      keys_first + decomp[i].begin(),
+      keys_first + decomp[i].end(),
+      values_first + decomp[i].begin(),
+      comp);
+  });
 
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
+  // merge neighboring runs of h sorted tiles pairwise until a single run is left.
+  // each merge is itself spread over all threads, so the last passes don't leave
+  // most of them waiting at a barrier
+  for (index_type h = 1; h < nseg; h *= 2)
+  {
+    for (index_type a = 0; a + h < nseg; a += 2 * h)
+    {
+      index_type c = (a + 2 * h < nseg) ? a + 2 * h - 1 : nseg - 1;
+
+      inplace_merge_by_key(
+        exec,
+        keys_first + decomp[a].begin(),
+        keys_first + decomp[a + h].begin(),
+        keys_first + decomp[c].end(),
+        values_first + decomp[a].begin(),
+        comp);
+    }
+  }
+}
 
-        b = c;
-        c += h;
-      }
+//////////////
+// PDQ Sort //
+//////////////
+
+// ranges smaller than this are sorted by a single task. sorting 32K ints takes
+// on the order of a millisecond, which dwarfs the cost of spawning a task,
+// while large inputs still split into many more tasks than there are threads
+// XXX the threshold is a tuning opportunity, e.g. by the size of the keys and
+// the cost of comp
+const static std::ptrdiff_t pdqsort_threshold = 32 * 1024;
+
+// sorts the ranges left of the pivots in omp tasks, while the current task
+// carries on with the range to the right
+template <bool Branchless, typename StrictWeakOrdering>
+struct pdqsort_task_recurse
+{
+  StrictWeakOrdering& comp;
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+  template <typename RandomAccessIterator>
+  void operator()(RandomAccessIterator first, RandomAccessIterator last, int bad_allowed, bool leftmost)
+  {
+    namespace pdqsort_detail = thrust::system::detail::sequential::pdqsort_detail;
 
-      THRUST_PRAGMA_OMP(barrier)
+    if (last - first < pdqsort_threshold)
+    {
+      pdqsort_detail::sequential_recurse<Branchless, StrictWeakOrdering> recurse{comp};
+      pdqsort_detail::pdqsort_loop<Branchless>(first, last, comp, bad_allowed, leftmost, recurse);
+      return;
     }
+
+    pdqsort_task_recurse recurse = *this;
+
+    THRUST_PRAGMA_OMP(task firstprivate(first, last, bad_allowed, leftmost, recurse))
+    pdqsort_detail::pdqsort_loop<Branchless>(first, last, recurse.comp, bad_allowed, leftmost, recurse);
   }
+};
+
+// an in-place parallel pdqsort: a single thread starts partitioning
+// [first, last), and the tasks it spawns are picked up by the others
+template <bool Branchless, typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void pdqsort(execution_policy<DerivedPolicy>& exec,
+             RandomAccessIterator first,
+             RandomAccessIterator last,
+             StrictWeakOrdering comp)
+{
+  namespace pdqsort_detail = thrust::system::detail::sequential::pdqsort_detail;
+
+  if (last - first < pdqsort_threshold)
+  {
+    thrust::system::detail::sequential::pdqsort<Branchless>(first, last, comp);
+    return;
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using wrapped_comp_type = thrust::detail::wrapped_function<StrictWeakOrdering, bool>;
+  wrapped_comp_type wrapped_comp(comp);
+
+  pdqsort_task_recurse<Branchless, wrapped_comp_type> recurse{wrapped_comp};
+
+  parallel_config config = parallel_config_of(exec);
+
+  int num_threads = config.num_threads > 0 ? config.num_threads : omp_get_max_threads();
+
+  // the tasks are all finished at the barrier which ends the single construct
+  THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
+  THRUST_PRAGMA_OMP(single)
+  pdqsort_detail::pdqsort_loop<Branchless>(
+    first, last, wrapped_comp, pdqsort_detail::log2(last - first), true, recurse);
+#else
+  (void) exec;
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
+// primitive keys, and keys ordered by a decomposer, are left to stable_sort
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void sort(execution_policy<DerivedPolicy>& exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering comp,
+          thrust::detail::true_type)
+{
+  thrust::system::omp::detail::stable_sort(exec, first, last, comp);
+}
+
 template <typename DerivedPolicy,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
           typename StrictWeakOrdering>
-void stable_sort_by_key(
+void sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  thrust::system::omp::detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void sort(execution_policy<DerivedPolicy>& exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering comp,
+          thrust::detail::false_type)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  sort_detail::pdqsort<
+    thrust::system::detail::sequential::pdqsort_detail::use_branchless_partition<key_type>::value>(
+    exec, first, last, comp);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
+{
+  namespace pdqsort_detail = thrust::system::detail::sequential::pdqsort_detail;
+
+  using key_type   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using value_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  // sort the keys and values together, comparing only the keys
+  auto zipped_first = thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first));
+
+  sort_detail::pdqsort<pdqsort_detail::use_branchless_partition<key_type>::value
+                       && pdqsort_detail::use_branchless_partition<value_type>::value>(
+    exec,
+    zipped_first,
+    zipped_first + (keys_last - keys_first),
+    thrust::detail::compare_first<StrictWeakOrdering>(comp));
+}
+
+} // namespace sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using KeyType = thrust::iterator_value_t<RandomAccessIterator>;
+
+  if (first == last)
+  {
+    return;
+  }
+
+  thrust::system::detail::internal::use_stable_sort<KeyType, StrictWeakOrdering> use_stable_sort;
+
+  sort_detail::sort(exec, first, last, comp, use_stable_sort);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void sort_by_key(
   execution_policy<DerivedPolicy>& exec,
   RandomAccessIterator1 keys_first,
   RandomAccessIterator1 keys_last,
@@ -186,72 +576,80 @@ void stable_sort_by_key(
                                              (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
     "OpenMP compiler support is not enabled");
 
-  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using KeyType = thrust::iterator_value_t<RandomAccessIterator1>;
 
   if (keys_first == keys_last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
-  {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
-      keys_last - keys_first, 1, omp_get_num_threads());
+  thrust::system::detail::internal::use_stable_sort<KeyType, StrictWeakOrdering> use_stable_sort;
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
-
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
-    {
-      thrust::stable_sort_by_key(
-        thrust::seq,
-        keys_first + decomp[p_i].begin(),
-        keys_first + decomp[p_i].end(),
-        values_first + decomp[p_i].begin(),
-        comp);
-    }
+  sort_detail::sort_by_key(exec, keys_first, keys_last, values_first, comp, use_stable_sort);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
 
-    THRUST_PRAGMA_OMP(barrier)
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
 
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using KeyType = thrust::iterator_value_t<RandomAccessIterator>;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+  if (first == last)
+  {
+    return;
+  }
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+  thrust::system::detail::internal::use_parallel_radix_sort<KeyType, StrictWeakOrdering> use_radix_sort;
 
-    while (nseg > 1)
-    {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
+  sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
 
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
-
-        b = c;
-        c += h;
-      }
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using KeyType = thrust::iterator_value_t<RandomAccessIterator1>;
 
-      THRUST_PRAGMA_OMP(barrier)
-    }
+  if (keys_first == keys_last)
+  {
+    return;
   }
+
+  thrust::system::detail::internal::use_parallel_radix_sort<KeyType, StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp, use_radix_sort);
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
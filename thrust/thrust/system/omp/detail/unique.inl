@@ -25,8 +25,13 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/pair.h>
 #include <thrust/system/detail/generic/unique.h>
+#include <thrust/system/omp/detail/compaction.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/unique.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -36,13 +41,113 @@ namespace omp
 {
 namespace detail
 {
+namespace unique_detail
+{
+
+// copies the heads of the runs in a tile to output + offset
+template <typename InputIterator, typename OutputIterator, typename BinaryPredicate>
+struct write_tile
+{
+  InputIterator first;
+  OutputIterator output;
+  BinaryPredicate binary_pred;
+
+  write_tile(InputIterator first, OutputIterator output, BinaryPredicate binary_pred)
+      : first(first)
+      , output(output)
+      , binary_pred(binary_pred)
+  {}
+
+  template <typename Range, typename Size>
+  void operator()(const Range& r, Size offset, Size) const
+  {
+    thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_binary_pred(binary_pred);
+
+    OutputIterator out = output + offset;
+
+    for (Size i = r.begin(); i != r.end(); ++i)
+    {
+      if (i == 0 || !wrapped_binary_pred(first[i - 1], first[i]))
+      {
+        *out = first[i];
+        ++out;
+      }
+    }
+  }
+};
+
+// moves the heads of the runs in a tile to its front, returning how many there are.
+// elements are only written to positions before the one being visited, so the last
+// element of a tile never changes and the next tile may compare its first element
+// to it concurrently
+template <typename ForwardIterator, typename BinaryPredicate>
+struct unique_tile
+{
+  ForwardIterator first;
+  BinaryPredicate binary_pred;
+
+  unique_tile(ForwardIterator first, BinaryPredicate binary_pred)
+      : first(first)
+      , binary_pred(binary_pred)
+  {}
+
+  template <typename Range>
+  typename Range::index_type operator()(const Range& r) const
+  {
+    using Size       = typename Range::index_type;
+    using value_type = typename thrust::iterator_value<ForwardIterator>::type;
+
+    thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_binary_pred(binary_pred);
+
+    // the element preceding the one being visited, as it was before compaction
+    value_type prev = first[r.begin()];
+
+    Size kept = (r.begin() == 0 || !wrapped_binary_pred(first[r.begin() - 1], prev)) ? 1 : 0;
+
+    for (Size i = r.begin() + 1; i != r.end(); ++i)
+    {
+      value_type current = first[i];
+
+      if (!wrapped_binary_pred(prev, current))
+      {
+        if (r.begin() + kept != i)
+        {
+          first[r.begin() + kept] = current;
+        }
+
+        ++kept;
+      }
+
+      prev = current;
+    }
+
+    return kept;
+  }
+};
+
+} // namespace unique_detail
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 ForwardIterator
 unique(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique to cpp::unique
-  return thrust::system::detail::generic::unique(exec, first, last, binary_pred);
+  using Size = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return first;
+  }
+
+  using UniqueTile = unique_detail::unique_tile<ForwardIterator, BinaryPredicate>;
+
+  // every thread moves the heads of the runs in its own tile to the front
+  // of the tile, then they are gathered at the front
+  Size num_kept = compact_tiles_in_place(
+    exec, first, thrust::system::omp::detail::default_decomposition<Size>(exec, n), UniqueTile(first, binary_pred));
+
+  return first + num_kept;
 } // end unique()
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryPredicate>
@@ -53,8 +158,27 @@ OutputIterator unique_copy(
   OutputIterator output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_copy to cpp::unique_copy
-  return thrust::system::detail::generic::unique_copy(exec, first, last, output, binary_pred);
+  using Size = typename thrust::iterator_difference<InputIterator>::type;
+
+  Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return output;
+  }
+
+  using CountTile = count_run_heads<InputIterator, BinaryPredicate>;
+  using WriteTile = unique_detail::write_tile<InputIterator, OutputIterator, BinaryPredicate>;
+
+  // every thread counts the heads of the runs in its tile, then copies them
+  // to its slice of the output
+  Size num_kept = compact_tiles(
+    exec,
+    thrust::system::omp::detail::default_decomposition<Size>(exec, n),
+    CountTile(first, binary_pred),
+    WriteTile(first, output, binary_pred));
+
+  return output + num_kept;
 } // end unique_copy()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
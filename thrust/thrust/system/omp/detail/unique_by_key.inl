@@ -25,8 +25,13 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/pair.h>
-#include <thrust/system/detail/generic/unique_by_key.h>
+#include <thrust/system/omp/detail/compaction.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/unique_by_key.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -36,6 +41,109 @@ namespace omp
 {
 namespace detail
 {
+namespace unique_by_key_detail
+{
+
+// copies the heads of the runs of keys in a tile and their values to the outputs + offset
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+struct write_tile
+{
+  InputIterator1 keys_first;
+  InputIterator2 values_first;
+  OutputIterator1 keys_output;
+  OutputIterator2 values_output;
+  BinaryPredicate binary_pred;
+
+  write_tile(InputIterator1 keys_first,
+             InputIterator2 values_first,
+             OutputIterator1 keys_output,
+             OutputIterator2 values_output,
+             BinaryPredicate binary_pred)
+      : keys_first(keys_first)
+      , values_first(values_first)
+      , keys_output(keys_output)
+      , values_output(values_output)
+      , binary_pred(binary_pred)
+  {}
+
+  template <typename Range, typename Size>
+  void operator()(const Range& r, Size offset, Size) const
+  {
+    thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_binary_pred(binary_pred);
+
+    OutputIterator1 keys_result   = keys_output + offset;
+    OutputIterator2 values_result = values_output + offset;
+
+    for (Size i = r.begin(); i != r.end(); ++i)
+    {
+      if (i == 0 || !wrapped_binary_pred(keys_first[i - 1], keys_first[i]))
+      {
+        *keys_result   = keys_first[i];
+        *values_result = values_first[i];
+        ++keys_result;
+        ++values_result;
+      }
+    }
+  }
+};
+
+// moves the heads of the runs of keys in a tile and their values to its front,
+// returning how many there are. as with unique_detail::unique_tile the last key
+// of a tile never changes, so the next tile may compare its first key to it
+// concurrently
+template <typename ForwardIterator1, typename ForwardIterator2, typename BinaryPredicate>
+struct unique_tile
+{
+  ForwardIterator1 keys_first;
+  ForwardIterator2 values_first;
+  BinaryPredicate binary_pred;
+
+  unique_tile(ForwardIterator1 keys_first, ForwardIterator2 values_first, BinaryPredicate binary_pred)
+      : keys_first(keys_first)
+      , values_first(values_first)
+      , binary_pred(binary_pred)
+  {}
+
+  template <typename Range>
+  typename Range::index_type operator()(const Range& r) const
+  {
+    using Size     = typename Range::index_type;
+    using key_type = typename thrust::iterator_value<ForwardIterator1>::type;
+
+    thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_binary_pred(binary_pred);
+
+    // the key preceding the one being visited, as it was before compaction
+    key_type prev = keys_first[r.begin()];
+
+    Size kept = (r.begin() == 0 || !wrapped_binary_pred(keys_first[r.begin() - 1], prev)) ? 1 : 0;
+
+    for (Size i = r.begin() + 1; i != r.end(); ++i)
+    {
+      key_type current = keys_first[i];
+
+      if (!wrapped_binary_pred(prev, current))
+      {
+        if (r.begin() + kept != i)
+        {
+          keys_first[r.begin() + kept]   = current;
+          values_first[r.begin() + kept] = values_first[i];
+        }
+
+        ++kept;
+      }
+
+      prev = current;
+    }
+
+    return kept;
+  }
+};
+
+} // namespace unique_by_key_detail
 
 template <typename DerivedPolicy, typename ForwardIterator1, typename ForwardIterator2, typename BinaryPredicate>
 thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key(
@@ -45,8 +153,26 @@ thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key(
   ForwardIterator2 values_first,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key to cpp::unique_by_key
-  return thrust::system::detail::generic::unique_by_key(exec, keys_first, keys_last, values_first, binary_pred);
+  using Size = typename thrust::iterator_difference<ForwardIterator1>::type;
+
+  Size n = thrust::distance(keys_first, keys_last);
+
+  if (n == 0)
+  {
+    return thrust::make_pair(keys_first, values_first);
+  }
+
+  using UniqueTile = unique_by_key_detail::unique_tile<ForwardIterator1, ForwardIterator2, BinaryPredicate>;
+
+  // every thread moves the heads of the runs in its own tile to the front of
+  // the tile, then keys and values are gathered at the front together
+  Size num_kept = compact_tiles_in_place(
+    exec,
+    thrust::make_zip_iterator(keys_first, values_first),
+    thrust::system::omp::detail::default_decomposition<Size>(exec, n),
+    UniqueTile(keys_first, values_first, binary_pred));
+
+  return thrust::make_pair(keys_first + num_kept, values_first + num_kept);
 } // end unique_by_key()
 
 template <typename DerivedPolicy,
@@ -64,9 +190,28 @@ thrust::pair<OutputIterator1, OutputIterator2> unique_by_key_copy(
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key_copy to cpp::unique_by_key_copy
-  return thrust::system::detail::generic::unique_by_key_copy(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  Size n = thrust::distance(keys_first, keys_last);
+
+  if (n == 0)
+  {
+    return thrust::make_pair(keys_output, values_output);
+  }
+
+  using CountTile = count_run_heads<InputIterator1, BinaryPredicate>;
+  using WriteTile =
+    unique_by_key_detail::write_tile<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2, BinaryPredicate>;
+
+  // every thread counts the heads of the runs in its tile, then copies them
+  // and their values to its slice of the outputs
+  Size num_kept = compact_tiles(
+    exec,
+    thrust::system::omp::detail::default_decomposition<Size>(exec, n),
+    CountTile(keys_first, binary_pred),
+    WriteTile(keys_first, values_first, keys_output, values_output, binary_pred));
+
+  return thrust::make_pair(keys_output + num_kept, values_output + num_kept);
 } // end unique_by_key_copy()
 
 } // end namespace detail
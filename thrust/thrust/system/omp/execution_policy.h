@@ -146,6 +146,13 @@ struct tag : thrust::system::omp::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  The parallel loops of an algorithm invoked with \p thrust::omp::par may be tuned per call:
+ *  <tt>par.num_threads(n)</tt> caps the number of threads of each parallel region,
+ *  <tt>par.schedule(thrust::omp::schedule_dynamic)</tt> (or \p schedule_guided, or the default
+ *  \p schedule_static) selects how work is handed to the threads, and <tt>par.grain(n)</tt> sets
+ *  the smallest number of elements handed to a thread at once. The modifiers may be chained, and
+ *  combined with an allocator as in <tt>par(alloc).num_threads(8)</tt>.
  */
 static const unspecified par;
 
@@ -79,6 +79,11 @@ inline void free(pointer<void> ptr);
  *  containers such as <tt>omp::vector</tt> if no user-specified allocator is
  *  provided. \p omp::allocator allocates (deallocates) storage with \p
  *  omp::malloc (\p omp::free).
+ *
+ *  Containers using it, including <tt>host_vector<T, omp::allocator<T>></tt>,
+ *  construct their elements in parallel, with the same static schedule as the
+ *  \p omp algorithms, so that on NUMA systems each page is first touched, and
+ *  placed, by a thread that later processes it.
  */
 template <typename T>
 using allocator = thrust::mr::stateless_resource_allocator<T, thrust::system::omp::memory_resource>;
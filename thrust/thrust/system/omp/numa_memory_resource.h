@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file omp/numa_memory_resource.h
+ *  \brief NUMA-aware memory resource and allocator for the OpenMP system.
+ *
+ *  This header is not included by the other \p omp headers, because it pulls
+ *  in the Linux system headers used by \p mr::numa_memory_resource. Include it
+ *  directly to use \p omp::numa_memory_resource or \p omp::numa_allocator.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if defined(__linux__)
+
+#  include <thrust/mr/allocator.h>
+#  include <thrust/mr/fancy_pointer_resource.h>
+#  include <thrust/mr/mmap.h>
+#  include <thrust/system/omp/memory.h>
+#  include <thrust/system/omp/pointer.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+
+//! \cond
+namespace detail
+{
+using numa_native_resource =
+  thrust::mr::fancy_pointer_resource<thrust::mr::numa_memory_resource, thrust::omp::pointer<void>>;
+} // namespace detail
+//! \endcond
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The NUMA-aware memory resource for the OpenMP system. Uses \p mr::numa_memory_resource and tags it with
+ *  \p omp::pointer. Only available on Linux.
+ */
+using numa_memory_resource = detail::numa_native_resource;
+
+/*! \}
+ */
+
+/*! \p omp::numa_allocator allocates memory with \p omp::numa_memory_resource, interleaving its pages across NUMA nodes.
+ *  Like \p omp::allocator, it makes containers such as <tt>host_vector<T, omp::numa_allocator<T>></tt> construct
+ *  their elements in parallel. Only available on Linux.
+ */
+template <typename T>
+using numa_allocator = thrust::mr::stateless_resource_allocator<T, thrust::system::omp::numa_memory_resource>;
+
+} // namespace omp
+} // namespace system
+
+namespace omp
+{
+using thrust::system::omp::numa_allocator;
+} // namespace omp
+
+THRUST_NAMESPACE_END
+
+#endif // __linux__
@@ -0,0 +1,172 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/batched_search.h>
+#include <thrust/system/tbb/detail/binary_search.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace binary_search_detail
+{
+
+template <typename Search,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Size,
+          typename StrictWeakOrdering>
+struct body
+{
+  RandomAccessIterator1 first;
+  Size n;
+  RandomAccessIterator2 values;
+  RandomAccessIterator3 output;
+  StrictWeakOrdering comp;
+
+  body(RandomAccessIterator1 first,
+       Size n,
+       RandomAccessIterator2 values,
+       RandomAccessIterator3 output,
+       StrictWeakOrdering comp)
+      : first(first)
+      , n(n)
+      , values(values)
+      , output(output)
+      , comp(comp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    thrust::system::detail::internal::batched_search<Search>(
+      first, n, values + r.begin(), static_cast<Size>(r.size()), output + r.begin(), comp);
+  }
+};
+
+// the needles are split into chunks of at least one batch, which are searched in parallel
+template <typename Search,
+          typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator batched_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using Size = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  const Size n          = thrust::distance(begin, end);
+  const Size num_values = thrust::distance(values_begin, values_end);
+
+  using Body = body<Search, ForwardIterator, InputIterator, OutputIterator, Size, StrictWeakOrdering>;
+
+  const Size grain =
+    static_cast<Size>(grain_of(exec, thrust::system::detail::internal::batched_search_detail::batch_size));
+
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_values, grain), Body(begin, n, values_begin, output, comp));
+  });
+
+  return output + num_values;
+}
+
+} // namespace binary_search_detail
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::batched_search<thrust::system::detail::internal::lower_bound_search>(
+    exec, begin, end, values_begin, values_end, output, comp);
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::batched_search<thrust::system::detail::internal::upper_bound_search>(
+    exec, begin, end, values_begin, values_end, output, comp);
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::batched_search<thrust::system::detail::internal::binary_search_search>(
+    exec, begin, end, values_begin, values_end, output, comp);
+}
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -28,8 +28,18 @@
 #include <thrust/detail/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/system/detail/generic/copy.h>
+#include <thrust/system/detail/internal/trivial_copy.h>
 #include <thrust/system/detail/sequential/copy.h>
+#include <thrust/system/detail/sequential/trivial_copy.h>
 #include <thrust/system/tbb/detail/copy.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+#include <cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -38,6 +48,59 @@ namespace tbb
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+template <typename DerivedPolicy, typename T>
+T* trivial_copy_n(execution_policy<DerivedPolicy>& exec, const T* first, std::ptrdiff_t n, T* result)
+{
+  if (!thrust::system::detail::internal::use_parallel_trivial_copy(first, n, result))
+  {
+    return thrust::system::detail::sequential::trivial_copy_n(first, n, result);
+  }
+
+  const std::size_t bytes      = static_cast<std::size_t>(n) * sizeof(T);
+  const std::size_t num_chunks = thrust::system::detail::internal::trivial_copy_num_chunks(bytes);
+  const std::size_t grain      = grain_of(exec);
+
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<std::size_t>(0, num_chunks, grain),
+                        [=](const ::tbb::blocked_range<std::size_t>& r) {
+                          for (std::size_t i = r.begin(); i < r.end(); ++i)
+                          {
+                            thrust::system::detail::internal::trivial_copy_chunk(first, result, bytes, i);
+                          }
+                        });
+  });
+
+  return result + n;
+} // end trivial_copy_n()
+
+// contiguous ranges of trivially relocatable elements are copied with memcpy
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
+OutputIterator copy_n(execution_policy<DerivedPolicy>& exec,
+                      InputIterator first,
+                      Size n,
+                      OutputIterator result,
+                      thrust::detail::true_type) // is_indirectly_trivially_relocatable_to
+{
+  copy_detail::trivial_copy_n(
+    exec, thrust::unwrap_contiguous_iterator(first), n, thrust::unwrap_contiguous_iterator(result));
+  return result + n;
+} // end copy_n()
+
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
+OutputIterator copy_n(execution_policy<DerivedPolicy>& exec,
+                      InputIterator first,
+                      Size n,
+                      OutputIterator result,
+                      thrust::detail::false_type) // is_indirectly_trivially_relocatable_to
+{
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
+} // namespace copy_detail
+
 namespace dispatch
 {
 
@@ -60,7 +123,12 @@ copy(execution_policy<DerivedPolicy>& exec,
      OutputIterator result,
      thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return copy_detail::copy_n(
+    exec,
+    first,
+    last - first,
+    result,
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::type());
 } // end copy()
 
 template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
@@ -82,7 +150,12 @@ copy_n(execution_policy<DerivedPolicy>& exec,
        OutputIterator result,
        thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return copy_detail::copy_n(
+    exec,
+    first,
+    n,
+    result,
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::type());
 } // end copy_n()
 
 } // namespace dispatch
@@ -29,6 +29,7 @@
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/tbb/detail/copy_if.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_scan.h>
@@ -111,9 +112,18 @@ struct body
 
 } // namespace copy_if_detail
 
-template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Predicate>
-OutputIterator
-copy_if(tag, InputIterator1 first, InputIterator1 last, InputIterator2 stencil, OutputIterator result, Predicate pred)
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Predicate>
+OutputIterator copy_if(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator result,
+  Predicate pred)
 {
   using Size = typename thrust::iterator_difference<InputIterator1>::type;
   using Body = typename copy_if_detail::body<InputIterator1, InputIterator2, OutputIterator, Predicate, Size>;
@@ -123,7 +133,10 @@ copy_if(tag, InputIterator1 first, InputIterator1 last, InputIterator2 stencil,
   if (n != 0)
   {
     Body body(first, stencil, result, pred);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), body);
+    const Size grain = static_cast<Size>(grain_of(exec));
+    execute_in_arena(exec, [&] {
+      ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n, grain), body);
+    });
     thrust::advance(result, body.sum);
   }
 
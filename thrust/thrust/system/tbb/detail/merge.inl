@@ -32,6 +32,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
 
 #include <tbb/parallel_for.h>
 
@@ -255,7 +256,7 @@ template <typename DerivedPolicy,
           typename OutputIterator,
           typename StrictWeakOrdering>
 OutputIterator
-merge(execution_policy<DerivedPolicy>&,
+merge(execution_policy<DerivedPolicy>& exec,
       InputIterator1 first1,
       InputIterator1 last1,
       InputIterator2 first2,
@@ -265,10 +266,12 @@ merge(execution_policy<DerivedPolicy>&,
 {
   using Range = typename merge_detail::range<InputIterator1, InputIterator2, OutputIterator, StrictWeakOrdering>;
   using Body  = merge_detail::body;
-  Range range(first1, last1, first2, last2, result, comp);
+  Range range(first1, last1, first2, last2, result, comp, grain_of(exec, 1024));
   Body body;
 
-  ::tbb::parallel_for(range, body);
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_for(range, body);
+  });
 
   thrust::advance(result, thrust::distance(first1, last1) + thrust::distance(first2, last2));
 
@@ -284,7 +287,7 @@ template <typename DerivedPolicy,
           typename OutputIterator2,
           typename StrictWeakOrdering>
 thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator1 keys_first1,
   InputIterator1 keys_last1,
   InputIterator2 keys_first2,
@@ -306,10 +309,21 @@ thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   using Body = merge_by_key_detail::body;
 
   Range range(
-    keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
+    keys_first1,
+    keys_last1,
+    keys_first2,
+    keys_last2,
+    values_first3,
+    values_first4,
+    keys_result,
+    values_result,
+    comp,
+    grain_of(exec, 1024));
   Body body;
 
-  ::tbb::parallel_for(range, body);
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_for(range, body);
+  });
 
   thrust::advance(keys_result, thrust::distance(keys_first1, keys_last1) + thrust::distance(keys_first2, keys_last2));
   thrust::advance(values_result, thrust::distance(keys_first1, keys_last1) + thrust::distance(keys_first2, keys_last2));
@@ -27,6 +27,9 @@
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
+
+#include <cstddef>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,13 +39,96 @@ namespace tbb
 namespace detail
 {
 
+template <typename Arena>
+void execute_in_task_arena(void* arena, void (*f)(void*), void* context)
+{
+  static_cast<Arena*>(arena)->execute([=] {
+    f(context);
+  });
+}
+
+template <typename Derived>
+struct execute_with_parallel_config_base : execution_policy<Derived>
+{
+private:
+  parallel_config config;
+
+public:
+  execute_with_parallel_config_base(const parallel_config& config_ = parallel_config())
+      : config(config_)
+  {}
+
+  // runs the algorithm inside arena, which must outlive the call. Arena is
+  // expected to be a ::tbb::task_arena
+  template <typename Arena>
+  Derived on(Arena& arena) const
+  {
+    Derived result        = thrust::detail::derived_cast(*this);
+    result.config.arena   = &arena;
+    result.config.execute = &execute_in_task_arena<Arena>;
+    return result;
+  }
+
+  // the grain of the blocked_ranges the algorithm parallelizes over
+  Derived grain(std::size_t n) const
+  {
+    Derived result      = thrust::detail::derived_cast(*this);
+    result.config.grain = n;
+    return result;
+  }
+
+  // the input size below which the algorithm, or a recursive step of it, runs
+  // sequentially
+  Derived cutoff(std::size_t n) const
+  {
+    Derived result       = thrust::detail::derived_cast(*this);
+    result.config.cutoff = n;
+    return result;
+  }
+
+private:
+  friend parallel_config get_parallel_config(const execute_with_parallel_config_base& exec)
+  {
+    return exec.config;
+  }
+};
+
+struct execute_with_parallel_config : execute_with_parallel_config_base<execute_with_parallel_config>
+{
+  using base_t = execute_with_parallel_config_base<execute_with_parallel_config>;
+
+  execute_with_parallel_config()
+      : base_t()
+  {}
+
+  execute_with_parallel_config(const parallel_config& config)
+      : base_t(config)
+  {}
+};
+
 struct par_t
     : thrust::system::tbb::detail::execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<thrust::system::tbb::detail::execution_policy>
+    , thrust::detail::allocator_aware_execution_policy<execute_with_parallel_config_base>
 {
   _CCCL_HOST_DEVICE constexpr par_t()
       : thrust::system::tbb::detail::execution_policy<par_t>()
   {}
+
+  template <typename Arena>
+  execute_with_parallel_config on(Arena& arena) const
+  {
+    return execute_with_parallel_config().on(arena);
+  }
+
+  execute_with_parallel_config grain(std::size_t n) const
+  {
+    return execute_with_parallel_config().grain(n);
+  }
+
+  execute_with_parallel_config cutoff(std::size_t n) const
+  {
+    return execute_with_parallel_config().cutoff(n);
+  }
 };
 
 } // namespace detail
@@ -0,0 +1,118 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+// the tuning parameters carried by a tbb execution policy.
+// the arena is type-erased so that policies may be named without including
+// TBB: execute runs f(context) inside it. a grain or cutoff of zero means the
+// algorithm's own default
+struct parallel_config
+{
+  void* arena;
+  void (*execute)(void* arena, void (*f)(void*), void* context);
+  std::size_t grain;
+  std::size_t cutoff;
+
+  parallel_config()
+      : arena(nullptr)
+      , execute(nullptr)
+      , grain(0)
+      , cutoff(0)
+  {}
+};
+
+// Fallback implementation of the customization point.
+template <typename Derived>
+parallel_config get_parallel_config(const execution_policy<Derived>&)
+{
+  return parallel_config();
+}
+
+// Entry point/interface.
+template <typename Derived>
+parallel_config parallel_config_of(execution_policy<Derived>& exec)
+{
+  return get_parallel_config(thrust::detail::derived_cast(exec));
+}
+
+template <typename Function>
+void invoke_in_arena(void* f)
+{
+  (*static_cast<Function*>(f))();
+}
+
+// runs f() inside the task_arena attached to exec, or in the calling thread's
+// arena when there is none
+template <typename Derived, typename Function>
+void execute_in_arena(execution_policy<Derived>& exec, Function f)
+{
+  parallel_config config = parallel_config_of(exec);
+
+  if (config.arena)
+  {
+    config.execute(config.arena, &invoke_in_arena<Function>, &f);
+  }
+  else
+  {
+    f();
+  }
+}
+
+// the grain of the blocked_ranges an algorithm parallelizes over
+template <typename Derived>
+std::size_t grain_of(execution_policy<Derived>& exec, std::size_t default_grain = 1)
+{
+  parallel_config config = parallel_config_of(exec);
+
+  return config.grain > 0 ? config.grain : default_grain;
+}
+
+// the input size below which an algorithm runs sequentially
+template <typename Derived>
+std::size_t cutoff_of(execution_policy<Derived>& exec, std::size_t default_cutoff)
+{
+  parallel_config config = parallel_config_of(exec);
+
+  return config.cutoff > 0 ? config.cutoff : default_cutoff;
+}
+
+} // namespace detail
+} // namespace tbb
+} // namespace system
+THRUST_NAMESPACE_END
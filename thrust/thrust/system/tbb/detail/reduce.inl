@@ -30,6 +30,8 @@
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/sequential/reduce.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_reduce.h>
@@ -50,6 +52,7 @@ struct body
   RandomAccessIterator first;
   OutputType sum;
   bool first_call; // TBB can invoke operator() multiple times on the same body
+  BinaryFunction range_op; // unwrapped, so the sequential reduce can tell which operator it is
   thrust::detail::wrapped_function<BinaryFunction, OutputType> binary_op;
 
   // note: we only initalize sum with init to avoid calling OutputType's default constructor
@@ -57,6 +60,7 @@ struct body
       : first(first)
       , sum(init)
       , first_call(true)
+      , range_op(binary_op)
       , binary_op(binary_op)
   {}
 
@@ -65,6 +69,7 @@ struct body
       : first(b.first)
       , sum(b.sum)
       , first_call(true)
+      , range_op(b.range_op)
       , binary_op(b.binary_op)
   {}
 
@@ -84,10 +89,11 @@ struct body
 
     ++iter;
 
-    for (Size i = r.begin() + 1; i != r.end(); ++i, ++iter)
-    {
-      temp = binary_op(temp, *iter);
-    }
+    using use_reduce_lanes = thrust::system::detail::sequential::reduce_detail::
+      use_reduce_lanes<RandomAccessIterator, OutputType, BinaryFunction>;
+
+    temp = thrust::system::detail::sequential::reduce_detail::reduce(
+      iter, first + r.end(), temp, range_op, use_reduce_lanes());
 
     if (first_call)
     {
@@ -111,8 +117,11 @@ struct body
 } // namespace reduce_detail
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
-OutputType reduce(
-  execution_policy<DerivedPolicy>&, InputIterator begin, InputIterator end, OutputType init, BinaryFunction binary_op)
+OutputType reduce(execution_policy<DerivedPolicy>& exec,
+                  InputIterator begin,
+                  InputIterator end,
+                  OutputType init,
+                  BinaryFunction binary_op)
 {
   using Size = typename thrust::iterator_difference<InputIterator>::type;
 
@@ -126,7 +135,10 @@ OutputType reduce(
   {
     using Body = typename reduce_detail::body<InputIterator, OutputType, BinaryFunction>;
     Body reduce_body(begin, init, binary_op);
-    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n), reduce_body);
+    const Size grain = static_cast<Size>(grain_of(exec));
+    execute_in_arena(exec, [&] {
+      ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n, grain), reduce_body);
+    });
     return binary_op(init, reduce_body.sum);
   }
 }
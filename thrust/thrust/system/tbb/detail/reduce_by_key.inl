@@ -32,13 +32,14 @@
 #include <thrust/detail/type_traits/iterator/is_output_iterator.h>
 #include <thrust/iterator/reverse_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/system/tbb/detail/concurrency.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
 #include <thrust/system/tbb/detail/reduce_by_key.h>
 #include <thrust/system/tbb/detail/reduce_intervals.h>
 #include <thrust/type_traits/void_t.h>
 
 #include <cassert>
-#include <thread>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
@@ -314,8 +315,8 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
     return thrust::make_pair(keys_result, values_result);
   }
 
-  // XXX this value is a tuning opportunity
-  const difference_type parallelism_threshold = 10000;
+  // XXX the default cutoff is a tuning opportunity
+  const difference_type parallelism_threshold = static_cast<difference_type>(cutoff_of(exec, 10000));
 
   if (n < parallelism_threshold)
   {
@@ -325,7 +326,7 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
   }
 
   // count the number of processors
-  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+  const unsigned int p = static_cast<unsigned int>(max_concurrency_of(exec));
 
   // generate O(P) intervals of sequential work
   // XXX oversubscribing is a tuning opportunity
@@ -363,21 +364,23 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
   thrust::detail::temporary_array<carry_type, DerivedPolicy> carries(0, exec, num_intervals - 1);
 
   // force grainsize == 1 with simple_partioner()
-  ::tbb::parallel_for(
-    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
-    reduce_by_key_detail::make_serial_reduce_by_key_body(
-      keys_first,
-      values_first,
-      interval_output_offsets.begin(),
-      keys_result,
-      values_result,
-      carries.begin(),
-      n,
-      interval_size,
-      num_intervals,
-      binary_pred,
-      binary_op),
-    ::tbb::simple_partitioner());
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+      reduce_by_key_detail::make_serial_reduce_by_key_body(
+        keys_first,
+        values_first,
+        interval_output_offsets.begin(),
+        keys_result,
+        values_result,
+        carries.begin(),
+        n,
+        interval_size,
+        num_intervals,
+        binary_pred,
+        binary_op),
+      ::tbb::simple_partitioner());
+  });
 
   difference_type size_of_result = interval_output_offsets[num_intervals];
 
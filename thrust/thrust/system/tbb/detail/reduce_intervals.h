@@ -31,6 +31,7 @@
 #include <thrust/reduce.h>
 #include <thrust/system/cpp/memory.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
 
 #include <cassert>
 
@@ -103,7 +104,7 @@ template <typename DerivedPolicy,
           typename RandomAccessIterator2,
           typename BinaryFunction>
 void reduce_intervals(
-  thrust::tbb::execution_policy<DerivedPolicy>&,
+  thrust::tbb::execution_policy<DerivedPolicy>& exec,
   RandomAccessIterator1 first,
   RandomAccessIterator1 last,
   Size interval_size,
@@ -114,9 +115,11 @@ void reduce_intervals(
 
   Size num_intervals = reduce_intervals_detail::divide_ri(n, interval_size);
 
-  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
-                      reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op),
-                      ::tbb::simple_partitioner());
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
+                        reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op),
+                        ::tbb::simple_partitioner());
+  });
 }
 
 template <typename DerivedPolicy, typename RandomAccessIterator1, typename Size, typename RandomAccessIterator2>
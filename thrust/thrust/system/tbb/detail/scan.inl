@@ -25,13 +25,13 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/advance.h>
 #include <thrust/detail/function.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/type_traits/function_traits.h>
 #include <thrust/detail/type_traits/iterator/is_output_iterator.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
 #include <thrust/system/tbb/detail/scan.h>
 
 #include <tbb/blocked_range.h>
@@ -226,9 +226,13 @@ struct exclusive_body
 
 } // namespace scan_detail
 
-template <typename InputIterator, typename OutputIterator, typename BinaryFunction>
-OutputIterator
-inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator result, BinaryFunction binary_op)
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
@@ -242,17 +246,27 @@ inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator resu
   {
     using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType>;
     Body scan_body(first, result, binary_op, *first);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+    const Size grain = static_cast<Size>(grain_of(exec));
+    execute_in_arena(exec, [&] {
+      ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n, grain), scan_body);
+    });
   }
 
-  thrust::advance(result, n);
-
-  return result;
+  return result + n;
 }
 
-template <typename InputIterator, typename OutputIterator, typename InitialValueType, typename BinaryFunction>
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
 OutputIterator exclusive_scan(
-  tag, InputIterator first, InputIterator last, OutputIterator result, InitialValueType init, BinaryFunction binary_op)
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
@@ -266,12 +280,13 @@ OutputIterator exclusive_scan(
   {
     using Body = typename scan_detail::exclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType>;
     Body scan_body(first, result, binary_op, init);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+    const Size grain = static_cast<Size>(grain_of(exec));
+    execute_in_arena(exec, [&] {
+      ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n, grain), scan_body);
+    });
   }
 
-  thrust::advance(result, n);
-
-  return result;
+  return result + n;
 }
 
 } // end namespace detail
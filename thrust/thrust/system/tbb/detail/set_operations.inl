@@ -0,0 +1,385 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/set_operations.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/tbb/detail/concurrency.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
+#include <thrust/system/tbb/detail/set_operations.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace set_operations_detail
+{
+
+struct serial_set_difference
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_intersection
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_intersection(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_symmetric_difference
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_union
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_union(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+// counts the output of every interval, storing the count of interval i to counts[i + 1]
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename SizeIterator,
+          typename StrictWeakOrdering,
+          typename SerialSetOperation>
+struct count_body
+{
+  using size_type = typename thrust::iterator_value<SizeIterator>::type;
+
+  InputIterator1 first1;
+  InputIterator2 first2;
+  SizeIterator splits1;
+  SizeIterator splits2;
+  SizeIterator counts;
+  StrictWeakOrdering comp;
+  SerialSetOperation set_op;
+
+  count_body(InputIterator1 first1,
+             InputIterator2 first2,
+             SizeIterator splits1,
+             SizeIterator splits2,
+             SizeIterator counts,
+             StrictWeakOrdering comp,
+             SerialSetOperation set_op)
+      : first1(first1)
+      , first2(first2)
+      , splits1(splits1)
+      , splits2(splits2)
+      , counts(counts)
+      , comp(comp)
+      , set_op(set_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::discard_iterator<> counter = thrust::make_discard_iterator();
+
+      counts[i + 1] = set_op(first1 + splits1[i],
+                             first1 + splits1[i + 1],
+                             first2 + splits2[i],
+                             first2 + splits2[i + 1],
+                             counter,
+                             comp)
+                    - counter;
+    }
+  }
+};
+
+// writes the output of every interval i to result + offsets[i]
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename SizeIterator,
+          typename StrictWeakOrdering,
+          typename SerialSetOperation>
+struct write_body
+{
+  using size_type = typename thrust::iterator_value<SizeIterator>::type;
+
+  InputIterator1 first1;
+  InputIterator2 first2;
+  OutputIterator result;
+  SizeIterator splits1;
+  SizeIterator splits2;
+  SizeIterator offsets;
+  StrictWeakOrdering comp;
+  SerialSetOperation set_op;
+
+  write_body(InputIterator1 first1,
+             InputIterator2 first2,
+             OutputIterator result,
+             SizeIterator splits1,
+             SizeIterator splits2,
+             SizeIterator offsets,
+             StrictWeakOrdering comp,
+             SerialSetOperation set_op)
+      : first1(first1)
+      , first2(first2)
+      , result(result)
+      , splits1(splits1)
+      , splits2(splits2)
+      , offsets(offsets)
+      , comp(comp)
+      , set_op(set_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type i = r.begin(); i != r.end(); ++i)
+    {
+      set_op(first1 + splits1[i],
+             first1 + splits1[i + 1],
+             first2 + splits2[i],
+             first2 + splits2[i + 1],
+             result + offsets[i],
+             comp);
+    }
+  }
+};
+
+// The set operations split both inputs into O(P) intervals along the merge
+// path, such that no run of equivalent elements straddles two intervals.
+// Each interval is then processed by the sequential algorithm twice: first
+// into a discard_iterator to count its output, then, after a scan of the
+// counts, into its slice of the result. The result is identical to the
+// sequential one.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SerialSetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SerialSetOperation set_op)
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const difference_type n1 = thrust::distance(first1, last1);
+  const difference_type n2 = thrust::distance(first2, last2);
+
+  // XXX the default cutoff is a tuning opportunity
+  const difference_type parallelism_threshold = static_cast<difference_type>(cutoff_of(exec, 10000));
+
+  if (n1 + n2 < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  // count the number of processors
+  const difference_type p = max_concurrency_of(exec);
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp(n1 + n2, 1, p);
+
+  const difference_type num_intervals = decomp.size();
+
+  // interval i covers [splits1[i], splits1[i + 1]) and [splits2[i], splits2[i + 1])
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> splits1(exec, num_intervals + 1);
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> splits2(exec, num_intervals + 1);
+
+  // offsets[i + 1] is the size of the output of interval i until it is scanned
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> offsets(exec, num_intervals + 1);
+
+  // finding the O(P) splits takes O(P log(N)) time, so don't bother parallelizing it
+  for (difference_type i = 0; i < num_intervals; ++i)
+  {
+    thrust::pair<difference_type, difference_type> split =
+      thrust::system::detail::internal::set_operation_path(first1, n1, first2, n2, decomp[i].begin(), comp);
+
+    splits1[i] = split.first;
+    splits2[i] = split.second;
+  }
+
+  splits1[num_intervals] = n1;
+  splits2[num_intervals] = n2;
+  offsets[0]             = 0;
+
+  using size_iterator = typename thrust::detail::temporary_array<difference_type, DerivedPolicy>::iterator;
+
+  // force grainsize == 1 with simple_partioner()
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+      count_body<InputIterator1, InputIterator2, size_iterator, StrictWeakOrdering, SerialSetOperation>(
+        first1, first2, splits1.begin(), splits2.begin(), offsets.begin(), comp, set_op),
+      ::tbb::simple_partitioner());
+  });
+
+  // scan the counts to get each body's output offset
+  thrust::inclusive_scan(thrust::seq, offsets.begin() + 1, offsets.end(), offsets.begin() + 1);
+
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+      write_body<InputIterator1, InputIterator2, OutputIterator, size_iterator, StrictWeakOrdering, SerialSetOperation>(
+        first1, first2, result, splits1.begin(), splits2.begin(), offsets.begin(), comp, set_op),
+      ::tbb::simple_partitioner());
+  });
+
+  return result + offsets[num_intervals];
+}
+
+} // end namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_difference());
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_intersection());
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_symmetric_difference());
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_union());
+} // end set_union()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
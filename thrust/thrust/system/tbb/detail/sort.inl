@@ -26,14 +26,30 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/detail/sequential/pdqsort.h>
+#include <thrust/system/tbb/detail/concurrency.h>
+#include <thrust/system/tbb/detail/parallel_config.h>
+
+#include <cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 #include <tbb/parallel_invoke.h>
+#include <tbb/task_group.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -98,7 +114,7 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
 
   difference_type n = thrust::distance(first1, last1);
 
-  if (n < threshold)
+  if (n < static_cast<difference_type>(cutoff_of(exec, threshold)))
   {
     thrust::stable_sort(thrust::seq, first1, last1, comp);
 
@@ -119,7 +135,9 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
   Closure left(exec, first1, mid1, first2, comp, !inplace);
   Closure right(exec, mid1, last1, mid2, comp, !inplace);
 
-  ::tbb::parallel_invoke(left, right);
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_invoke(left, right);
+  });
 
   if (inplace)
   {
@@ -223,7 +241,7 @@ void merge_sort_by_key(
   Iterator2 last2 = first2 + n;
   Iterator3 last3 = first3 + n;
 
-  if (n < threshold)
+  if (n < static_cast<difference_type>(cutoff_of(exec, threshold)))
   {
     thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
 
@@ -242,7 +260,9 @@ void merge_sort_by_key(
   Closure left(exec, first1, mid1, first2, first3, first4, comp, !inplace);
   Closure right(exec, mid1, last1, mid2, mid3, mid4, comp, !inplace);
 
-  ::tbb::parallel_invoke(left, right);
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_invoke(left, right);
+  });
 
   if (inplace)
   {
@@ -256,9 +276,236 @@ void merge_sort_by_key(
 
 } // namespace sort_by_key_detail
 
+namespace radix_sort_detail
+{
+
+// counts the digits of every tile i into histograms[i * num_buckets, (i + 1) * num_buckets)
+template <typename RandomAccessIterator, typename Size, typename Digit>
+struct count_body
+{
+  RandomAccessIterator keys;
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp;
+  Digit digit;
+  std::size_t* histograms;
+
+  count_body(RandomAccessIterator keys,
+             thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+             Digit digit,
+             std::size_t* histograms)
+      : keys(keys)
+      , decomp(decomp)
+      , digit(digit)
+      , histograms(histograms)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size i = r.begin(); i != r.end(); ++i)
+    {
+      std::size_t* histogram = histograms + i * Digit::num_buckets;
+
+      for (unsigned int d = 0; d < Digit::num_buckets; ++d)
+      {
+        histogram[d] = 0;
+      }
+
+      for (Size j = decomp[i].begin(); j != decomp[i].end(); ++j)
+      {
+        histogram[digit(keys[j])]++;
+      }
+    }
+  }
+};
+
+// scatters the keys (and values) of every tile i to the offsets scanned into its histogram
+template <bool HasValues,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename Digit>
+struct scatter_body
+{
+  RandomAccessIterator1 keys_src;
+  RandomAccessIterator2 vals_src;
+  RandomAccessIterator3 keys_dst;
+  RandomAccessIterator4 vals_dst;
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp;
+  Digit digit;
+  std::size_t* histograms;
+
+  scatter_body(RandomAccessIterator1 keys_src,
+               RandomAccessIterator2 vals_src,
+               RandomAccessIterator3 keys_dst,
+               RandomAccessIterator4 vals_dst,
+               thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+               Digit digit,
+               std::size_t* histograms)
+      : keys_src(keys_src)
+      , vals_src(vals_src)
+      , keys_dst(keys_dst)
+      , vals_dst(vals_dst)
+      , decomp(decomp)
+      , digit(digit)
+      , histograms(histograms)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+    for (Size i = r.begin(); i != r.end(); ++i)
+    {
+      std::size_t* offsets = histograms + i * Digit::num_buckets;
+
+      for (Size j = decomp[i].begin(); j != decomp[i].end(); ++j)
+      {
+        key_type key = keys_src[j];
+
+        std::size_t k = offsets[digit(key)]++;
+
+        keys_dst[k] = key;
+
+        if (HasValues)
+        {
+          vals_dst[k] = vals_src[j];
+        }
+      }
+    }
+  }
+};
+
+// Moves the keys (and values) into the order of one digit. Returns false,
+// without moving anything, if all keys share that digit.
+template <bool HasValues,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename Digit>
+bool radix_pass(execution_policy<DerivedPolicy>& exec,
+                RandomAccessIterator1 keys_src,
+                RandomAccessIterator2 vals_src,
+                RandomAccessIterator3 keys_dst,
+                RandomAccessIterator4 vals_dst,
+                const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+                Digit digit,
+                std::size_t* histograms)
+{
+  const Size num_tiles = decomp.size();
+
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                        count_body<RandomAccessIterator1, Size, Digit>(keys_src, decomp, digit, histograms),
+                        ::tbb::simple_partitioner());
+  });
+
+  if (!thrust::system::detail::internal::radix_scan_histograms<Digit::num_buckets>(
+        histograms, num_tiles, static_cast<std::size_t>(decomp[num_tiles - 1].end())))
+  {
+    return false;
+  }
+
+  using Body = scatter_body<HasValues,
+                            RandomAccessIterator1,
+                            RandomAccessIterator2,
+                            RandomAccessIterator3,
+                            RandomAccessIterator4,
+                            Size,
+                            Digit>;
+
+  execute_in_arena(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                        Body(keys_src, vals_src, keys_dst, vals_dst, decomp, digit, histograms),
+                        ::tbb::simple_partitioner());
+  });
+
+  return true;
+}
+
+// LSD radix sort of [keys1, keys1 + n) with 8-bit digits. Each pass counts
+// digits per tile, scans the tile histograms, and scatters every tile in
+// parallel, ping-ponging between (keys1, vals1) and (keys2, vals2).
+template <bool HasValues,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename StrictWeakOrdering>
+void radix_sort(execution_policy<DerivedPolicy>& exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                RandomAccessIterator3 vals1,
+                RandomAccessIterator4 vals2,
+                Size n,
+                StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using Digit    = thrust::system::detail::internal::radix_digit<key_type, StrictWeakOrdering>;
+
+  // XXX the number of tiles is a tuning opportunity
+  const Size p = static_cast<Size>(max_concurrency_of(exec));
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp(n, 1, p);
+
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> histograms(exec, decomp.size() * Digit::num_buckets);
+
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
+
+  for (unsigned int pass = 0; pass < Digit::num_passes; ++pass)
+  {
+    std::size_t* raw_histograms = thrust::raw_pointer_cast(histograms.data());
+
+    Digit digit(pass, comp);
+
+    bool moved = flip ? radix_pass<HasValues>(exec, keys2, vals2, keys1, vals1, decomp, digit, raw_histograms)
+                      : radix_pass<HasValues>(exec, keys1, vals1, keys2, vals2, decomp, digit, raw_histograms);
+
+    if (moved)
+    {
+      flip = !flip;
+    }
+  }
+
+  // ensure final values are in (keys1,vals1)
+  if (flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
+
+    if (HasValues)
+    {
+      thrust::copy(exec, vals2, vals2 + n, vals1);
+    }
+  }
+}
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void stable_sort(
-  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, thrust::distance(first, last));
+
+  radix_sort<false>(
+    exec, first, temp.begin(), static_cast<int*>(0), static_cast<int*>(0), thrust::distance(first, last), comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
 {
   using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
 
@@ -276,7 +523,29 @@ void stable_sort_by_key(
   RandomAccessIterator1 first1,
   RandomAccessIterator1 last1,
   RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using val_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, thrust::distance(first1, last1));
+  thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, thrust::distance(first1, last1));
+
+  radix_sort<true>(exec, first1, temp1.begin(), first2, temp2.begin(), thrust::distance(first1, last1), comp);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
   using val_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
@@ -289,6 +558,233 @@ void stable_sort_by_key(
   sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
 }
 
+} // namespace radix_sort_detail
+
+namespace pdqsort_detail
+{
+
+// sorts the ranges left of the pivots in tasks of group, while the current
+// task carries on with the range to the right
+template <bool Branchless, typename StrictWeakOrdering>
+struct task_recurse
+{
+  ::tbb::task_group& group;
+  StrictWeakOrdering& comp;
+  std::ptrdiff_t cutoff;
+
+  template <typename RandomAccessIterator>
+  void operator()(RandomAccessIterator first, RandomAccessIterator last, int bad_allowed, bool leftmost)
+  {
+    namespace sequential = thrust::system::detail::sequential;
+
+    if (last - first < cutoff)
+    {
+      sequential::pdqsort_detail::sequential_recurse<Branchless, StrictWeakOrdering> recurse{comp};
+      sequential::pdqsort_detail::pdqsort_loop<Branchless>(first, last, comp, bad_allowed, leftmost, recurse);
+      return;
+    }
+
+    const task_recurse self = *this;
+
+    group.run([=] {
+      task_recurse recurse = self;
+      sequential::pdqsort_detail::pdqsort_loop<Branchless>(first, last, recurse.comp, bad_allowed, leftmost, recurse);
+    });
+  }
+};
+
+// an in-place parallel pdqsort: partitions are sorted in a task_group, and
+// ranges smaller than the cutoff by a single task
+template <bool Branchless, typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void pdqsort(execution_policy<DerivedPolicy>& exec,
+             RandomAccessIterator first,
+             RandomAccessIterator last,
+             StrictWeakOrdering comp,
+             std::ptrdiff_t cutoff)
+{
+  namespace sequential = thrust::system::detail::sequential;
+
+  using wrapped_comp_type = thrust::detail::wrapped_function<StrictWeakOrdering, bool>;
+  wrapped_comp_type wrapped_comp(comp);
+
+  execute_in_arena(exec, [&] {
+    ::tbb::task_group group;
+
+    task_recurse<Branchless, wrapped_comp_type> recurse{group, wrapped_comp, cutoff};
+    sequential::pdqsort_detail::pdqsort_loop<Branchless>(
+      first, last, wrapped_comp, sequential::pdqsort_detail::log2(last - first), true, recurse);
+
+    group.wait();
+  });
+}
+
+// primitive keys are left to stable_sort
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void sort(execution_policy<DerivedPolicy>& exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering comp,
+          thrust::detail::true_type)
+{
+  thrust::system::tbb::detail::stable_sort(exec, first, last, comp);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  thrust::system::tbb::detail::stable_sort_by_key(exec, first1, last1, first2, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void sort(execution_policy<DerivedPolicy>& exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering comp,
+          thrust::detail::false_type)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  pdqsort_detail::pdqsort<
+    thrust::system::detail::sequential::pdqsort_detail::use_branchless_partition<key_type>::value>(
+    exec, first, last, comp, static_cast<std::ptrdiff_t>(cutoff_of(exec, sort_detail::threshold)));
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
+{
+  namespace sequential = thrust::system::detail::sequential;
+
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using val_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  // sort the keys and values together, comparing only the keys
+  auto zipped_first = thrust::make_zip_iterator(thrust::make_tuple(first1, first2));
+
+  pdqsort_detail::pdqsort<sequential::pdqsort_detail::use_branchless_partition<key_type>::value
+                          && sequential::pdqsort_detail::use_branchless_partition<val_type>::value>(
+    exec,
+    zipped_first,
+    zipped_first + thrust::distance(first1, last1),
+    thrust::detail::compare_first<StrictWeakOrdering>(comp),
+    static_cast<std::ptrdiff_t>(cutoff_of(exec, sort_by_key_detail::threshold)));
+}
+
+} // namespace pdqsort_detail
+
+// Arithmetic keys ordered by less or greater, and keys ordered by a decomposer,
+// are left to stable_sort. Other keys are sorted in place by a parallel
+// pdqsort. Small inputs are left to the sequential sort.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  if (thrust::distance(first, last) < static_cast<difference_type>(cutoff_of(exec, sort_detail::threshold)))
+  {
+    thrust::sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  thrust::system::detail::internal::use_stable_sort<key_type, StrictWeakOrdering> use_stable_sort;
+
+  pdqsort_detail::sort(exec, first, last, comp, use_stable_sort);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+
+  if (thrust::distance(first1, last1) < static_cast<difference_type>(cutoff_of(exec, sort_by_key_detail::threshold)))
+  {
+    thrust::sort_by_key(thrust::seq, first1, last1, first2, comp);
+    return;
+  }
+
+  thrust::system::detail::internal::use_stable_sort<key_type, StrictWeakOrdering> use_stable_sort;
+
+  pdqsort_detail::sort_by_key(exec, first1, last1, first2, comp, use_stable_sort);
+}
+
+// Arithmetic keys ordered by less or greater, and keys ordered by a decomposer,
+// are sorted with a parallel radix sort. Small inputs are left to the
+// sequential sort, which is a radix sort for those keys as well.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  if (thrust::distance(first, last) < static_cast<difference_type>(cutoff_of(exec, sort_detail::threshold)))
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  thrust::system::detail::internal::use_parallel_radix_sort<key_type, StrictWeakOrdering> use_radix_sort;
+
+  radix_sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+
+  if (thrust::distance(first1, last1) < static_cast<difference_type>(cutoff_of(exec, sort_by_key_detail::threshold)))
+  {
+    thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
+    return;
+  }
+
+  thrust::system::detail::internal::use_parallel_radix_sort<key_type, StrictWeakOrdering> use_radix_sort;
+
+  radix_sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_radix_sort);
+}
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
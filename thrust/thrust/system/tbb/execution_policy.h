@@ -146,6 +146,13 @@ struct tag : thrust::system::tbb::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  An algorithm invoked with \p thrust::tbb::par may be confined to a particular <tt>tbb::task_arena</tt>, for
+ *  instance one constrained to a NUMA node, with <tt>par.on(arena)</tt>; the arena must outlive the call.
+ *  <tt>par.grain(n)</tt> sets the grain of the ranges the algorithm's parallel loops are split into, and
+ *  <tt>par.cutoff(n)</tt> the input size below which the algorithm, or a recursive step of it such as a merge
+ *  sort half, runs sequentially. The modifiers may be chained, and combined with an allocator as in
+ *  <tt>par(alloc).on(arena)</tt>.
  */
 static const unspecified par;
 